@@ -0,0 +1,266 @@
+/***********************************************************************
+* @file      AllocationGuard.h
+*
+*    Heap allocation accounting, so as to verify that the acquisition,
+*    validation and conversion paths of the SCL3300 driver never touch
+*    the heap once started; fragmentation over weeks of uptime being
+*    what eventually resets long-running nodes.
+*
+*    An AllocationGuard snapshots the allocation counters upon
+*    construction and reports whatever was allocated since:
+*
+*    - On Mbed targets, the counters are those of mbed_stats_heap_get(),
+*      which also sees malloc() from within the C library. Build with
+*      MBED_HEAP_STATS_ENABLED=1; otherwise nothing is ever counted.
+*    - Elsewhere, define SCL3300_DEFINE_ALLOCATION_HOOKS in exactly one
+*      translation unit to replace the global operator new/delete with
+*      counting versions.
+*
+* @brief
+*
+* @note    Define SCL3300_ZERO_HEAP to compile out those (convenience)
+*          driver APIs which return std::string, so that only the
+*          allocation-free ones remain available.
+*
+* @warning Mbed heap statistics do not count allocations, only bytes;
+*          GetAllocations() is hence always zero there.
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#pragma once
+
+#include <new>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+
+#if defined(__MBED__)
+#include "mbed_stats.h"
+#endif
+
+namespace Diagnostics
+{
+    struct AllocationSnapshot_t
+    {
+        uint32_t    m_Allocations;
+        std::size_t m_AllocatedBytes; // Cumulative.
+    };
+
+    // Updated by the counting operator new/delete, if so defined.
+    struct AllocationCounters_t
+    {
+        std::atomic<uint32_t>    m_Allocations{0};
+        std::atomic<uint32_t>    m_Deallocations{0};
+        std::atomic<std::size_t> m_AllocatedBytes{0};
+    };
+
+    inline AllocationCounters_t g_AllocationCounters;
+
+    inline AllocationSnapshot_t TakeAllocationSnapshot()
+    {
+#if defined(__MBED__)
+#if defined(MBED_HEAP_STATS_ENABLED) && MBED_HEAP_STATS_ENABLED
+        mbed_stats_heap_t stats{};
+        mbed_stats_heap_get(&stats);
+
+        return {0, static_cast<std::size_t>(stats.total_size)};
+#else
+        return {0, 0};
+#endif
+#else
+        return {g_AllocationCounters.m_Allocations.load(std::memory_order_relaxed),
+                g_AllocationCounters.m_AllocatedBytes.load(std::memory_order_relaxed)};
+#endif
+    }
+
+    class AllocationGuard
+    {
+    public:
+        AllocationGuard()
+            : m_Start(TakeAllocationSnapshot())
+        {
+        }
+
+        AllocationGuard(const AllocationGuard&) = delete;
+        AllocationGuard& operator=(const AllocationGuard&) = delete;
+
+        uint32_t GetAllocations() const
+        {
+            return (TakeAllocationSnapshot().m_Allocations - m_Start.m_Allocations);
+        }
+
+        std::size_t GetAllocatedBytes() const
+        {
+            return (TakeAllocationSnapshot().m_AllocatedBytes - m_Start.m_AllocatedBytes);
+        }
+
+        bool IsClean() const
+        {
+            return ((GetAllocations() == 0) && (GetAllocatedBytes() == 0));
+        }
+
+    private:
+        AllocationSnapshot_t m_Start;
+    };
+
+} // End of namespace Diagnostics.
+
+#if defined(SCL3300_DEFINE_ALLOCATION_HOOKS)
+namespace Diagnostics
+{
+    // Counts, then allocates; nullptr upon exhaustion. The alignment is
+    // zero for the ordinary (i.e. malloc()-aligned) forms.
+    inline void* CountedAllocate(std::size_t size, const std::size_t& alignment)
+    {
+        g_AllocationCounters.m_Allocations.fetch_add(1, std::memory_order_relaxed);
+        g_AllocationCounters.m_AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+        if (size == 0)
+        {
+            size = 1;
+        }
+
+        if (alignment == 0)
+        {
+            return std::malloc(size);
+        }
+
+        // aligned_alloc() requires a size that is a multiple of the alignment.
+        return std::aligned_alloc(alignment, ((size + alignment - 1) / alignment) * alignment);
+    }
+
+    inline void* CountedAllocateOrFail(const std::size_t& size, const std::size_t& alignment)
+    {
+        if (void* memory = CountedAllocate(size, alignment))
+        {
+            return memory;
+        }
+
+#if defined(__cpp_exceptions)
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+
+    inline void CountedDeallocate(void* memory) noexcept
+    {
+        if (memory != nullptr)
+        {
+            g_AllocationCounters.m_Deallocations.fetch_add(1, std::memory_order_relaxed);
+            std::free(memory);
+        }
+    }
+
+} // End of namespace Diagnostics.
+
+// Replaceable global allocation functions; every form is replaced, so
+// that neither the nothrow nor the over-aligned (alignas > 16) ones
+// escape the count through the library's own definitions.
+void* operator new(std::size_t size)
+{
+    return Diagnostics::CountedAllocateOrFail(size, 0);
+}
+
+void* operator new[](std::size_t size)
+{
+    return Diagnostics::CountedAllocateOrFail(size, 0);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Diagnostics::CountedAllocate(size, 0);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Diagnostics::CountedAllocate(size, 0);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return Diagnostics::CountedAllocateOrFail(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return Diagnostics::CountedAllocateOrFail(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return Diagnostics::CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return Diagnostics::CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+// aligned_alloc() memory is released with free() also; all the deletes
+// are hence alike.
+void operator delete(void* memory) noexcept
+{
+    Diagnostics::CountedDeallocate(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    Diagnostics::CountedDeallocate(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    Diagnostics::CountedDeallocate(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    Diagnostics::CountedDeallocate(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+    Diagnostics::CountedDeallocate(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+    Diagnostics::CountedDeallocate(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+    Diagnostics::CountedDeallocate(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept
+{
+    Diagnostics::CountedDeallocate(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept
+{
+    Diagnostics::CountedDeallocate(memory);
+}
+
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept
+{
+    Diagnostics::CountedDeallocate(memory);
+}
+
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    Diagnostics::CountedDeallocate(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    Diagnostics::CountedDeallocate(memory);
+}
+#endif
@@ -0,0 +1,220 @@
+/***********************************************************************
+* @file      BusScheduler.h
+*
+*    Interleaved acquisition from several SCL3300s sharing one SPI bus,
+*    each on its own chip select; e.g. the four inclinometers of a
+*    bridge-monitoring node.
+*
+*    Each device must leave its chip select high for 10 us between
+*    frames. Swept one after another, the devices would hence spend most
+*    of the bus time idling in their own inter-frame gaps. Instead, the
+*    scheduler begins every device's pipelined channel sweep together
+*    and then hands the bus, a frame at a time, to whichever device's
+*    gap has already elapsed; i.e. one device's gap is filled with the
+*    other devices' transfers. Only should no device be ready does it
+*    busy-wait, upon the one whose gap is closest to elapsing, and count
+*    the frame as stalled.
+*
+*    Each device validates its previous response during its own gap as
+*    usual, and retains its own latest sample.
+*
+* @brief
+*
+* @note    The devices must all be in normal operation and not otherwise
+*          in use (e.g. by a SamplingEngine) for the duration of a sweep.
+*
+* @warning Mbed reapplies an SPI object's format and frequency whenever
+*          the peripheral changes owners. That costs a little on each
+*          hand-over; configure all devices identically to keep it so.
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#pragma once
+
+#include <span>
+#include <array>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <system_error>
+
+#include "NuerteySCL3300Device.h"
+
+namespace Acquisition
+{
+    struct BusStatistics_t
+    {
+        uint32_t    m_SweepsCompleted{0};
+        uint32_t    m_SweepsFailed{0};   // Any device failing fails the sweep.
+        uint32_t    m_Frames{0};
+        uint32_t    m_StalledFrames{0};  // No device was past its gap.
+        MicroSecs_t m_MaximumSweepDuration{0};
+
+        double GetStallFraction() const
+        {
+            return (m_Frames == 0) ? 0.0 : (static_cast<double>(m_StalledFrames) / m_Frames);
+        }
+    };
+
+    template <typename Device_t, std::size_t N>
+    class BusScheduler
+    {
+        static_assert(N > 0, "A bus scheduler requires at least one device!");
+
+    public:
+        template <typename... Devices_t>
+            requires (sizeof...(Devices_t) == N)
+        explicit BusScheduler(Devices_t&... devices);
+
+        BusScheduler(const BusScheduler&) = delete;
+        BusScheduler& operator=(const BusScheduler&) = delete;
+
+        // Sweeps 'channels' of every device, recording each device's
+        // outcome in 'results'. Returns the first failure, if any.
+        std::error_code Sweep(const ChannelSet_t& channels,
+                              std::span<std::error_code, N> results);
+
+        static constexpr std::size_t GetDeviceCount() { return N; }
+
+        Device_t&       GetDevice(const std::size_t& index) { return *m_Devices[index]; }
+        const Device_t& GetDevice(const std::size_t& index) const { return *m_Devices[index]; }
+
+        BusStatistics_t GetStatistics() const { return m_Statistics; }
+        void ResetStatistics() { m_Statistics = BusStatistics_t{}; }
+        void PrintStatistics() const;
+
+    protected:
+        // Round-robin from the device after the last one served, so that
+        // no device's train is starved whilst others' gaps elapse.
+        std::size_t SelectNextDevice();
+
+    private:
+        std::array<Device_t*, N>      m_Devices;
+        std::array<ChannelSweep_t, N> m_Sweeps;
+        std::size_t                   m_LastServed;
+        BusStatistics_t               m_Statistics;
+    };
+
+    // E.g. BusScheduler scheduler(sensor0, sensor1, sensor2, sensor3);
+    template <typename Device_t, typename... Devices_t>
+    BusScheduler(Device_t&, Devices_t&...) -> BusScheduler<Device_t, 1 + sizeof...(Devices_t)>;
+
+    template <typename Device_t, std::size_t N>
+    template <typename... Devices_t>
+        requires (sizeof...(Devices_t) == N)
+    BusScheduler<Device_t, N>::BusScheduler(Devices_t&... devices)
+        : m_Devices{&devices...}
+        , m_Sweeps()
+        , m_LastServed(N - 1)
+        , m_Statistics()
+    {
+    }
+
+    template <typename Device_t, std::size_t N>
+    std::error_code BusScheduler<Device_t, N>::Sweep(const ChannelSet_t& channels,
+                                                     std::span<std::error_code, N> results)
+    {
+        std::error_code result{};
+
+        const auto start = MonotonicClock_t::now();
+
+        for (std::size_t index = 0; index < N; ++index)
+        {
+            results[index] = m_Devices[index]->BeginChannelSweep(m_Sweeps[index], channels);
+        }
+
+        for (std::size_t next = SelectNextDevice(); next < N; next = SelectNextDevice())
+        {
+            if (m_Devices[next]->RemainingInterFrameGap() > MicroSecs_t(0))
+            {
+                ++m_Statistics.m_StalledFrames;
+            }
+
+            m_Devices[next]->TransferNextFrame(m_Sweeps[next].m_Cursor);
+            m_LastServed = next;
+            ++m_Statistics.m_Frames;
+        }
+
+        for (std::size_t index = 0; index < N; ++index)
+        {
+            // Devices which failed to begin had nothing transferred.
+            if (!results[index])
+            {
+                results[index] = m_Devices[index]->ConcludeChannelSweep(m_Sweeps[index]);
+            }
+
+            if (results[index] && !result)
+            {
+                result = results[index];
+            }
+        }
+
+        const auto duration = std::chrono::duration_cast<MicroSecs_t>(MonotonicClock_t::now() - start);
+        m_Statistics.m_MaximumSweepDuration = std::max(m_Statistics.m_MaximumSweepDuration, duration);
+
+        if (result)
+        {
+            ++m_Statistics.m_SweepsFailed;
+
+            printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
+                      result.value(), GetErrorMessage(result));
+        }
+        else
+        {
+            ++m_Statistics.m_SweepsCompleted;
+        }
+
+        return result;
+    }
+
+    template <typename Device_t, std::size_t N>
+    std::size_t BusScheduler<Device_t, N>::SelectNextDevice()
+    {
+        std::size_t closest    = N; // I.e. every train is complete.
+        auto        closestGap = MicroSecs_t::max();
+
+        for (std::size_t offset = 1; offset <= N; ++offset)
+        {
+            const auto index = (m_LastServed + offset) % N;
+
+            if (m_Sweeps[index].m_Cursor.IsComplete())
+            {
+                continue;
+            }
+
+            const auto gap = m_Devices[index]->RemainingInterFrameGap();
+            if (gap == MicroSecs_t(0))
+            {
+                return index;
+            }
+
+            if (gap < closestGap)
+            {
+                closest    = index;
+                closestGap = gap;
+            }
+        }
+
+        return closest;
+    }
+
+    template <typename Device_t, std::size_t N>
+    void BusScheduler<Device_t, N>::PrintStatistics() const
+    {
+        printf("\nBus Scheduler Statistics (%u devices):\n", static_cast<unsigned>(N));
+        printf("\tSweeps Completed        := [%lu]\n", static_cast<unsigned long>(m_Statistics.m_SweepsCompleted));
+        printf("\tSweeps Failed           := [%lu]\n", static_cast<unsigned long>(m_Statistics.m_SweepsFailed));
+        printf("\tFrames                  := [%lu]\n", static_cast<unsigned long>(m_Statistics.m_Frames));
+        Formatting::TextBuffer_t<> buffer;
+
+        printf("\tStalled Frames          := [%lu] (%s%%)\n", static_cast<unsigned long>(m_Statistics.m_StalledFrames),
+            Formatting::FormatFixed(buffer, 100.0 * m_Statistics.GetStallFraction(), 1).data());
+        printf("\tMaximum Sweep Duration  := [%lld us]\n",
+            static_cast<long long>(m_Statistics.m_MaximumSweepDuration.count()));
+    }
+
+} // End of namespace Acquisition.
@@ -0,0 +1,274 @@
+/***********************************************************************
+* @file      Conversions.h
+*
+*    Integer (Q-format) conversions of SCL3300 register contents into
+*    engineering units:
+*
+*    - Acceleration:  milli-g                (mg)
+*    - Angle:         centi-degrees          (0.01 °)
+*    - Temperature:   centi-degrees Celsius  (0.01 °C)
+*
+*    Each conversion is a single 32-bit multiply, an add and a shift; no
+*    division, no floating-point. The acceleration scale factor depends
+*    upon the operation mode, hence ScaleFactors_t is meant to be chosen
+*    once per mode change and then reused for every sample thereafter.
+*
+*    Batch kernels convert whole spans of raw samples at a time, e.g. when
+*    post-processing recorded data. They are written as branch-free loops
+*    which the compiler vectorizes on the host. On the Cortex-M7, define
+*    SCL3300_USE_CMSIS_DSP (and link CMSIS-DSP) to have them call the
+*    CMSIS-DSP q15 kernels instead.
+*
+* @brief
+*
+* @note    Results are within one unit of the exact conversion, over
+*          the whole 16-bit register range.
+*
+* @warning
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#pragma once
+
+#include <span>
+#include <array>
+#include <limits>
+#include <cstdint>
+#include <cassert>
+
+#if defined(SCL3300_USE_CMSIS_DSP)
+#include "arm_math.h"
+#endif
+
+#include "Protocol.h"
+
+namespace Conversions
+{
+    using namespace ProtocolDefinitions;
+
+    using MilliG_t          = int32_t;
+    using CentiDegrees_t    = int32_t;
+    using CentiCelsius_t    = int32_t;
+
+    // Multiplies by 'multiplier / 2^shift', rounding to nearest. Note that
+    // right-shifting a negative value is arithmetic as of C++20.
+    constexpr int32_t ScaleQ(const int16_t& raw, const int32_t& multiplier, const uint8_t& shift)
+    {
+        return ((static_cast<int32_t>(raw) * multiplier) + (int32_t{1} << (shift - 1))) >> shift;
+    }
+
+    // \" - User selectable measurement modes:
+    //
+    // 3000 LSB/g with 70 Hz LPF
+    // 6000 LSB/g with 40 Hz LPF
+    // 12000 LSB/g with 10 Hz LPF
+    // \"
+    struct ScaleFactors_t
+    {
+        uint16_t m_AccelerationLSBPerG;
+
+        // mg = (raw * multiplier) >> shift.
+        int32_t  m_AccelerationMultiplier;
+        uint8_t  m_AccelerationShift;
+
+        // For those callers who prefer floating-point; g = raw * this.
+        double   m_AccelerationGPerLSB;
+    };
+
+    // Q16 keeps the worst-case product (32767 * 21845, Mode 2) within an
+    // int32_t whilst bounding the error to well under 1 mg.
+    constexpr uint8_t ACCELERATION_SHIFT = 16;
+
+    constexpr ScaleFactors_t MakeScaleFactors(const uint16_t& lsbPerG)
+    {
+        return ScaleFactors_t{
+            lsbPerG,
+            static_cast<int32_t>(((int64_t{1000} << ACCELERATION_SHIFT) + (lsbPerG / 2)) / lsbPerG),
+            ACCELERATION_SHIFT,
+            1.0 / static_cast<double>(lsbPerG)};
+    }
+
+    constexpr std::array<ScaleFactors_t, 4> SCALE_FACTORS{{
+        MakeScaleFactors(6000),   // \" Mode 1 ... 6000 LSB/g \"
+        MakeScaleFactors(3000),   // \" Mode 2 ... 3000 LSB/g \"
+        MakeScaleFactors(12000),  // \" Mode 3 ... 12000 LSB/g \"
+        MakeScaleFactors(12000)}};// \" Mode 4 ... 12000 LSB/g \"
+
+    constexpr const ScaleFactors_t& GetScaleFactors(const OperationMode_t& mode)
+    {
+        return SCALE_FACTORS[Utilities::ToUnderlyingType(mode)];
+    }
+
+    constexpr MilliG_t ToMilliG(const int16_t& acceleration, const ScaleFactors_t& factors)
+    {
+        return ScaleQ(acceleration, factors.m_AccelerationMultiplier, factors.m_AccelerationShift);
+    }
+
+    // \" Angle [°] = d'ANG_% / 2^14 * 90 \"
+    //
+    // In centi-degrees, that is exactly raw * 9000 / 2^14 = raw * 1125 / 2^11.
+    constexpr int32_t ANGLE_MULTIPLIER = 1125;
+    constexpr uint8_t ANGLE_SHIFT      = 11;
+
+    constexpr double  ANGLE_DEGREES_PER_LSB = 90.0 / static_cast<double>(1 << 14);
+
+    // Signed; i.e. within [-180.00°, +180.00°).
+    constexpr CentiDegrees_t ToCentiDegrees(const int16_t& angle)
+    {
+        return ScaleQ(angle, ANGLE_MULTIPLIER, ANGLE_SHIFT);
+    }
+
+    // Normalized; i.e. within [0.00°, 360.00°), as per the Get*Axis()
+    // accessors. The register is reinterpreted as unsigned, offsetting a
+    // negative reading by 2^16 LSB, i.e. exactly 360°; hence branch-free.
+    // 65535 * 1125 remains well within an int32_t.
+    constexpr CentiDegrees_t ToNormalizedCentiDegrees(const int16_t& angle)
+    {
+        return ((static_cast<int32_t>(static_cast<uint16_t>(angle)) * ANGLE_MULTIPLIER)
+                + (int32_t{1} << (ANGLE_SHIFT - 1))) >> ANGLE_SHIFT;
+    }
+
+    // \" Temperature [°C] = -273 + (TEMP / 18.9) \"
+    //
+    // In centi-degrees Celsius, raw * 1000 / 189 is approximated in Q10.
+    // Q10 rather than Q16 so that 32767 * 5418 remains within an int32_t.
+    constexpr uint8_t TEMPERATURE_SHIFT      = 10;
+    constexpr int32_t TEMPERATURE_MULTIPLIER = ((1000 << TEMPERATURE_SHIFT) + (189 / 2)) / 189;
+    constexpr int32_t TEMPERATURE_OFFSET     = -27300;
+
+    constexpr CentiCelsius_t ToCentiCelsius(const int16_t& temperature)
+    {
+        return TEMPERATURE_OFFSET + ScaleQ(temperature, TEMPERATURE_MULTIPLIER, TEMPERATURE_SHIFT);
+    }
+
+    // Compile-time sanity checks against hand-computed conversions
+    // and against the extremes of the register range.
+    static_assert(ToMilliG(6000, GetScaleFactors(OperationMode_t::MODE_1)) == 1000);
+    static_assert(ToMilliG(-3000, GetScaleFactors(OperationMode_t::MODE_2)) == -1000);
+    static_assert(ToMilliG(12000, GetScaleFactors(OperationMode_t::MODE_4)) == 1000);
+    static_assert(ToCentiDegrees(1 << 14) == 9000);
+    static_assert(ToCentiDegrees(std::numeric_limits<int16_t>::min()) == -18000);
+    static_assert(ToNormalizedCentiDegrees(1 << 14) == 9000);
+    static_assert(ToNormalizedCentiDegrees(-(1 << 14)) == 27000);
+    static_assert(ToNormalizedCentiDegrees(std::numeric_limits<int16_t>::min()) == 18000);
+    static_assert(ToNormalizedCentiDegrees(-1) == 35999);
+    static_assert(ToCentiCelsius(5160) == -27300 + 27302); // 5160 / 18.9 = 273.02
+    static_assert((int64_t{std::numeric_limits<int16_t>::max()}
+                  * GetScaleFactors(OperationMode_t::MODE_2).m_AccelerationMultiplier)
+                  <= std::numeric_limits<int32_t>::max());
+    static_assert((int64_t{std::numeric_limits<int16_t>::max()} * TEMPERATURE_MULTIPLIER)
+                  <= std::numeric_limits<int32_t>::max());
+
+    // =================================================================
+    // Batch kernels.
+    //
+    // Each converts 'raw' into 'converted', element for element. The 
+    // output span must be at least as long as the input span.
+    // =================================================================
+
+    // \" Temperature [°C] = -273 + (TEMP / 18.9) \"
+    constexpr float  TEMPERATURE_CELSIUS_PER_LSB    = 1.0f / 18.9f;
+    constexpr float  TEMPERATURE_OFFSET_CELSIUS     = -273.0f;
+
+    // A q15 value v represents v / 2^15; i.e. register contents are off
+    // by a factor of 2^15 once CMSIS-DSP has converted them to float.
+    constexpr float  Q15_TO_RAW                     = 32768.0f;
+
+    inline void ConvertAccelerations(std::span<const int16_t> raw,
+                                     std::span<float> converted,
+                                     const ScaleFactors_t& factors)
+    {
+        assert(((void)"Output span is too small!", (converted.size() >= raw.size())));
+
+        const auto gPerLSB = static_cast<float>(factors.m_AccelerationGPerLSB);
+
+#if defined(SCL3300_USE_CMSIS_DSP)
+        arm_q15_to_float(raw.data(), converted.data(), raw.size());
+        arm_scale_f32(converted.data(), gPerLSB * Q15_TO_RAW, converted.data(), raw.size());
+#else
+        for (std::size_t index = 0; index < raw.size(); ++index)
+        {
+            converted[index] = static_cast<float>(raw[index]) * gPerLSB;
+        }
+#endif
+    }
+
+    // Normalized to [0°, 360°), as per the Get*Axis() accessors. Rather
+    // than adding 360° to negative angles, the register is reinterpreted
+    // as unsigned: a negative reading is thereby offset by 2^16 LSB,
+    // which is exactly 360°. Hence no branch and no select.
+    inline void ConvertAngles(std::span<const int16_t> raw,
+                              std::span<float> converted)
+    {
+        assert(((void)"Output span is too small!", (converted.size() >= raw.size())));
+
+        constexpr auto degreesPerLSB = static_cast<float>(ANGLE_DEGREES_PER_LSB);
+
+        static_assert((static_cast<double>(1 << 16) * ANGLE_DEGREES_PER_LSB) == 360.0);
+
+        for (std::size_t index = 0; index < raw.size(); ++index)
+        {
+            converted[index] = static_cast<float>(static_cast<uint16_t>(raw[index])) * degreesPerLSB;
+        }
+    }
+
+    inline void ConvertTemperatures(std::span<const int16_t> raw,
+                                    std::span<float> converted)
+    {
+        assert(((void)"Output span is too small!", (converted.size() >= raw.size())));
+
+#if defined(SCL3300_USE_CMSIS_DSP)
+        arm_q15_to_float(raw.data(), converted.data(), raw.size());
+        arm_scale_f32(converted.data(), TEMPERATURE_CELSIUS_PER_LSB * Q15_TO_RAW, converted.data(), raw.size());
+        arm_offset_f32(converted.data(), TEMPERATURE_OFFSET_CELSIUS, converted.data(), raw.size());
+#else
+        for (std::size_t index = 0; index < raw.size(); ++index)
+        {
+            converted[index] = TEMPERATURE_OFFSET_CELSIUS 
+                             + (static_cast<float>(raw[index]) * TEMPERATURE_CELSIUS_PER_LSB);
+        }
+#endif
+    }
+
+    // Integer counterparts; these vectorize equally well.
+    inline void ConvertAccelerations(std::span<const int16_t> raw,
+                                     std::span<MilliG_t> converted,
+                                     const ScaleFactors_t& factors)
+    {
+        assert(((void)"Output span is too small!", (converted.size() >= raw.size())));
+
+        for (std::size_t index = 0; index < raw.size(); ++index)
+        {
+            converted[index] = ToMilliG(raw[index], factors);
+        }
+    }
+
+    // Normalized to [0, 36000) centi-degrees, as is its floating-point
+    // counterpart above.
+    inline void ConvertAngles(std::span<const int16_t> raw,
+                              std::span<CentiDegrees_t> converted)
+    {
+        assert(((void)"Output span is too small!", (converted.size() >= raw.size())));
+
+        for (std::size_t index = 0; index < raw.size(); ++index)
+        {
+            converted[index] = ToNormalizedCentiDegrees(raw[index]);
+        }
+    }
+
+    inline void ConvertTemperatures(std::span<const int16_t> raw,
+                                    std::span<CentiCelsius_t> converted)
+    {
+        assert(((void)"Output span is too small!", (converted.size() >= raw.size())));
+
+        for (std::size_t index = 0; index < raw.size(); ++index)
+        {
+            converted[index] = ToCentiCelsius(raw[index]);
+        }
+    }
+
+} // End of namespace Conversions.
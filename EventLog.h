@@ -0,0 +1,194 @@
+/***********************************************************************
+* @file      EventLog.h
+*
+*    Deferred, binary event logging for the SCL3300 driver hot paths.
+*
+*    Rather than format and print diagnostics where they arise (which,
+*    at 115200 baud, costs milliseconds per line), the driver records a
+*    fixed-size binary LogEvent_t, i.e. an event id, a timestamp and up
+*    to two integer arguments, into a wait-free SPSC ring. A low-priority
+*    thread later drains and formats the events, or else ships them raw
+*    to a host tool which decodes them against DRIVER_EVENTS.
+*
+*    Each event's severity is known at compile time. Events below
+*    SCL3300_LOG_SEVERITY are discarded by 'if constexpr' and hence
+*    cost nothing at all at their call sites.
+*
+* @brief
+*
+* @note    Define SCL3300_LOG_SEVERITY to one of the Severity_t values
+*          (0 = debug ... 4 = none) to choose what is compiled in. It
+*          defaults to info; i.e. per-frame debug events are left out.
+*
+* @warning Single producer: whichever thread is currently driving the
+*          device, or the SPI interrupt whilst an asynchronous frame
+*          train is in progress. Device calls are to be serialized
+*          regardless.
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+#include "Utilities.h"
+#include "SPSCRingBuffer.h"
+
+#if !defined(SCL3300_LOG_SEVERITY)
+#define SCL3300_LOG_SEVERITY 1
+#endif
+
+namespace Diagnostics
+{
+    enum class Severity_t : uint8_t
+    {
+        LEVEL_DEBUG   = 0,
+        LEVEL_INFO    = 1,
+        LEVEL_WARNING = 2,
+        LEVEL_ERROR   = 3,
+        LEVEL_NONE    = 4
+    };
+
+    constexpr Severity_t COMPILED_SEVERITY = static_cast<Severity_t>(SCL3300_LOG_SEVERITY);
+
+    static_assert(COMPILED_SEVERITY <= Severity_t::LEVEL_NONE, "Invalid SCL3300_LOG_SEVERITY!");
+
+    constexpr std::array<std::string_view, 5> SEVERITY_NAMES{{
+        "DEBUG", "INFO", "WARNING", "ERROR", "NONE"}};
+
+    constexpr std::string_view ToString(const Severity_t& severity)
+    {
+        return SEVERITY_NAMES[Utilities::ToUnderlyingType(severity)];
+    }
+
+    // Append-only; the numbering is part of the binary format which the
+    // host tool decodes.
+    enum class DriverEvent_t : uint16_t
+    {
+        BANK_SWITCHED                   = 0, // bank
+        SENSOR_DATA_READ                = 1, // channel, raw value
+        SENSOR_DATA_READ_FAILED         = 2, // error code, channel
+        PIPELINED_READ_FAILED           = 3, // error code
+        STATUS_SUMMARY_CLEARED          = 4, // STATUS
+        STATUS_SUMMARY_CLEAR_FAILED     = 5, // error code
+        SENSOR_STATE_CHANGED            = 6, // from, to
+        EVENT_QUEUE_EXHAUSTED           = 7, // error code
+        SENSOR_RECOVERY_STARTED         = 8, // error code, attempt
+        SENSOR_RECOVERY_ABANDONED       = 9, // error code, attempts
+        STARTUP_INDICATED               = 10, // RS
+        STARTUP_NOT_INDICATED           = 11, // RS
+        COMMAND_WRITTEN                 = 12, // command, response
+        COMMAND_WRITE_FAILED            = 13, // error code, command
+        ANGLE_OUTPUTS_ENABLED           = 14, // ANG_CTRL
+        ANGLE_OUTPUTS_ENABLE_FAILED     = 15, // error code
+        SERIAL_NUMBER_READ              = 16, // SERIAL2, SERIAL1
+        SERIAL_NUMBER_READ_FAILED       = 17, // error code
+        NUMBER_OF_EVENTS
+    };
+
+    struct EventDescriptor_t
+    {
+        Severity_t       m_Severity;
+        std::string_view m_Name;
+
+        // printf() format of both arguments, which are passed as long.
+        const char*      m_Format;
+
+        // The first argument is a SensorStatus_t, to be spelled out.
+        bool             m_HasErrorCode;
+    };
+
+    constexpr std::array<EventDescriptor_t, Utilities::ToUnderlyingType(DriverEvent_t::NUMBER_OF_EVENTS)> DRIVER_EVENTS{{
+        {Severity_t::LEVEL_DEBUG, "BANK_SWITCHED",               "Switched the SCL3300 sensor operations to memory bank %ld", false},
+        {Severity_t::LEVEL_DEBUG, "SENSOR_DATA_READ",            "Retrieved channel [%ld] := [%ld]",                          false},
+        {Severity_t::LEVEL_ERROR, "SENSOR_DATA_READ_FAILED",     "[%ld] Failed to retrieve channel [%ld]",                    true},
+        {Severity_t::LEVEL_ERROR, "PIPELINED_READ_FAILED",       "[%ld] Failed to retrieve all channels",                     true},
+        {Severity_t::LEVEL_INFO,  "STATUS_SUMMARY_CLEARED",      "Completed clearing the STATUS Summary register := [%ld]",   false},
+        {Severity_t::LEVEL_ERROR, "STATUS_SUMMARY_CLEAR_FAILED", "[%ld] Failed to clear the STATUS Summary register",         true},
+        {Severity_t::LEVEL_INFO,  "SENSOR_STATE_CHANGED",        "Sensor state [%ld] -> [%ld]",                               false},
+        {Severity_t::LEVEL_ERROR, "EVENT_QUEUE_EXHAUSTED",       "[%ld] Failed to post or schedule a sensor event",           true},
+        {Severity_t::LEVEL_WARNING, "SENSOR_RECOVERY_STARTED",   "[%ld] Software resetting the sensor; attempt [%ld]",        true},
+        {Severity_t::LEVEL_ERROR, "SENSOR_RECOVERY_ABANDONED",   "[%ld] Powering down after [%ld] software resets",           true},
+        {Severity_t::LEVEL_INFO,  "STARTUP_INDICATED",           "First STATUS response since cleared; RS [%ld] indicate proper start-up", false},
+        {Severity_t::LEVEL_WARNING, "STARTUP_NOT_INDICATED",     "Start-up has not been performed correctly; STATUS RS [%ld]", false},
+        {Severity_t::LEVEL_INFO,  "COMMAND_WRITTEN",             "Wrote command operation [%ld] := [%ld]",                    false},
+        {Severity_t::LEVEL_ERROR, "COMMAND_WRITE_FAILED",        "[%ld] Failed to write command operation [%ld]",             true},
+        {Severity_t::LEVEL_INFO,  "ANGLE_OUTPUTS_ENABLED",       "Enabled the angle outputs; ANG_CTRL := [%ld]",              false},
+        {Severity_t::LEVEL_ERROR, "ANGLE_OUTPUTS_ENABLE_FAILED", "[%ld] Failed to enable the angle outputs",                  true},
+        {Severity_t::LEVEL_DEBUG, "SERIAL_NUMBER_READ",          "Retrieved SERIAL2 := [%ld], SERIAL1 := [%ld]",              false},
+        {Severity_t::LEVEL_ERROR, "SERIAL_NUMBER_READ_FAILED",   "[%ld] Failed to retrieve the serial number",                true}}};
+
+    constexpr const EventDescriptor_t& GetDescriptor(const DriverEvent_t& event)
+    {
+        return DRIVER_EVENTS[Utilities::ToUnderlyingType(event)];
+    }
+
+    // The binary record; 16 bytes, little-endian on both the Cortex-M7
+    // and the usual hosts. Dumped as is for offline decoding.
+    struct LogEvent_t
+    {
+        uint32_t    m_TimestampMicroSecs; // Wraps after ~71 minutes.
+        uint16_t    m_Event;
+        uint8_t     m_Severity;
+        uint8_t     m_Reserved;
+        int32_t     m_Arguments[2];
+    };
+
+    static_assert(sizeof(LogEvent_t) == 16);
+    static_assert(std::is_trivially_copyable_v<LogEvent_t>);
+
+    // 1 KiB of events; ample between drains by a thread waking a few
+    // times a second, given that per-frame events are debug-only.
+    constexpr std::size_t DEFAULT_EVENT_LOG_CAPACITY = 64;
+
+    template <std::size_t Capacity = DEFAULT_EVENT_LOG_CAPACITY>
+    class EventLog
+    {
+    public:
+        using EventRing_t = Utilities::SPSCRingBuffer<LogEvent_t, Capacity>;
+
+        EventLog() = default;
+
+        // Producer side. Wait-free, hence also callable from an ISR.
+        // Compiles to nothing for events below COMPILED_SEVERITY.
+        template <DriverEvent_t Event>
+        void Record(const int32_t& argument0 = 0, const int32_t& argument1 = 0)
+        {
+            constexpr auto severity = GetDescriptor(Event).m_Severity;
+
+            if constexpr (severity >= COMPILED_SEVERITY)
+            {
+                const auto now = Utilities::MonotonicClock_t::now().time_since_epoch();
+
+                // When full, the newest event is dropped and counted.
+                m_Events.TryPush(LogEvent_t{
+                    static_cast<uint32_t>(now.count()),
+                    Utilities::ToUnderlyingType(Event),
+                    Utilities::ToUnderlyingType(severity),
+                    0,
+                    {argument0, argument1}});
+            }
+        }
+
+        // Consumer side. Hands 'consumer' spans of raw events, e.g. for
+        // fwrite()-ing to a host tool.
+        template <typename F>
+        std::size_t Drain(F&& consumer, const std::size_t& maximum = Capacity)
+        {
+            return m_Events.Drain(std::forward<F>(consumer), maximum);
+        }
+
+        uint32_t GetDroppedCount() const { return m_Events.GetOverruns(); }
+
+    private:
+        EventRing_t m_Events;
+    };
+
+} // End of namespace Diagnostics.
@@ -0,0 +1,293 @@
+/***********************************************************************
+* @file      Formatting.h
+*
+*    Allocation-free text formatting for console and telemetry output.
+*
+*    Every function writes into a caller-supplied buffer by way of
+*    std::to_chars, NUL-terminates it, and returns a std::string_view of
+*    what was written; i.e. the result may be handed straight to printf()
+*    via '%s' and .data(). Neither the heap nor the iostream machinery is
+*    ever touched.
+*
+*    Real numbers are formatted in fixed-point: the value is scaled by
+*    10^decimalDigits, rounded to an integer and then written as integer
+*    and fractional parts. Hence floating-point std::to_chars (and its
+*    sizeable tables) is not pulled into the image either.
+*
+* @brief
+*
+* @note    Should the buffer be too small, the result is truncated to
+*          the empty string (and asserted upon in debug builds).
+*
+* @warning The returned view aliases the buffer; it is valid only for as
+*          long as the buffer is, and until the buffer is reused.
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#pragma once
+
+#include <span>
+#include <array>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+#include <cassert>
+#include <charconv>
+#include <concepts>
+#include <string_view>
+#include <type_traits>
+
+namespace Formatting
+{
+    // Ample for any 64-bit integer, or a fixed-point double within the
+    // range of one, along with sign, radix point and NUL.
+    constexpr std::size_t NUMBER_BUFFER_SIZE = 32;
+
+    template <std::size_t N = NUMBER_BUFFER_SIZE>
+    using TextBuffer_t = std::array<char, N>;
+
+    constexpr uint8_t MAXIMUM_DECIMAL_DIGITS = 9;
+
+    constexpr std::array<uint64_t, MAXIMUM_DECIMAL_DIGITS + 1> POWERS_OF_TEN{{
+        1, 10, 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000,
+        100'000'000, 1'000'000'000}};
+
+    namespace Detail
+    {
+        // NUL-terminates at 'last', or else empties the buffer entirely
+        // should formatting have run out of room.
+        inline std::string_view Terminate(std::span<char> buffer, char* last, const bool& succeeded)
+        {
+            assert(((void)"Formatting buffer is too small!", succeeded));
+
+            if (!succeeded)
+            {
+                if (!buffer.empty())
+                {
+                    buffer[0] = '\0';
+                }
+                return {};
+            }
+
+            *last = '\0';
+            return std::string_view(buffer.data(), static_cast<std::size_t>(last - buffer.data()));
+        }
+
+        // Writes 'value' left-padded with zeros to at least 'width' digits.
+        inline std::to_chars_result ToCharsPadded(char* first, char* last, const uint64_t& value,
+                                                  const std::size_t& width, const int& base = 10)
+        {
+            std::array<char, std::numeric_limits<uint64_t>::digits> digits{};
+
+            const auto [end, error] = std::to_chars(digits.data(), digits.data() + digits.size(), value, base);
+            const auto length  = static_cast<std::size_t>(end - digits.data());
+            const auto padding = (width > length) ? (width - length) : 0;
+
+            if ((error != std::errc{}) || (static_cast<std::size_t>(last - first) < (padding + length)))
+            {
+                return {last, std::errc::value_too_large};
+            }
+
+            first = std::fill_n(first, padding, '0');
+            first = std::copy(digits.data(), end, first);
+
+            return {first, std::errc{}};
+        }
+    }
+
+    template <std::integral T>
+    std::string_view FormatInteger(std::span<char> buffer, const T& value)
+    {
+        if (buffer.empty())
+        {
+            return {};
+        }
+
+        char* const last = buffer.data() + buffer.size() - 1; // Room for the NUL.
+        const auto [end, error] = std::to_chars(buffer.data(), last, value);
+
+        return Detail::Terminate(buffer, end, (error == std::errc{}));
+    }
+
+    // E.g. 0.125 with 2 decimal digits yields "0.13"; halves are rounded
+    // away from zero. Non-finite values are spelled "nan" and "inf". Finite
+    // values beyond the fixed-point range (i.e. 2^63 / 10^decimalDigits)
+    // are written in exponent form instead; e.g. 1e20 yields "1.00e+20".
+    inline std::string_view FormatFixed(std::span<char> buffer, const double& value,
+                                        const uint8_t& decimalDigits = 2)
+    {
+        assert(((void)"Too many decimal digits requested!", (decimalDigits <= MAXIMUM_DECIMAL_DIGITS)));
+
+        if (buffer.empty())
+        {
+            return {};
+        }
+
+        char*       first = buffer.data();
+        char* const last  = buffer.data() + buffer.size() - 1; // Room for the NUL.
+
+        const auto  scale  = POWERS_OF_TEN[std::min(decimalDigits, MAXIMUM_DECIMAL_DIGITS)];
+        const auto  scaled = std::fabs(value) * static_cast<double>(scale);
+
+        std::string_view special{};
+        if (std::isnan(value))
+        {
+            special = "nan";
+        }
+        else if (std::isinf(value))
+        {
+            special = std::signbit(value) ? "-inf" : "inf";
+        }
+        else if (!(scaled < static_cast<double>(std::numeric_limits<int64_t>::max())))
+        {
+            // The mantissa is within [1, 10) and hence formats in fixed-
+            // point, unless log10() is off by an ulp or rounding carries
+            // it to 10.
+            auto exponent = static_cast<int>(std::floor(std::log10(std::fabs(value))));
+            auto mantissa = value / std::pow(10.0, exponent);
+
+            if (std::fabs(mantissa) < 1.0)
+            {
+                mantissa *= 10.0;
+                --exponent;
+            }
+            else if ((std::fabs(mantissa) + (0.5 / static_cast<double>(scale))) >= 10.0)
+            {
+                mantissa /= 10.0;
+                ++exponent;
+            }
+
+            const auto mantissaText = FormatFixed(buffer, mantissa, decimalDigits);
+            if (mantissaText.empty())
+            {
+                return {};
+            }
+
+            first = buffer.data() + mantissaText.size();
+            if ((last - first) < 2)
+            {
+                return Detail::Terminate(buffer, first, false);
+            }
+            *first++ = 'e';
+            *first++ = (exponent < 0) ? '-' : '+';
+
+            const auto result = Detail::ToCharsPadded(first, last, static_cast<uint64_t>(std::abs(exponent)), 2);
+
+            return Detail::Terminate(buffer, result.ptr, (result.ec == std::errc{}));
+        }
+
+        if (!special.empty())
+        {
+            const bool fits = (special.size() <= static_cast<std::size_t>(last - first));
+            if (fits)
+            {
+                first = std::copy(special.begin(), special.end(), first);
+            }
+            return Detail::Terminate(buffer, first, fits);
+        }
+
+        const auto magnitude  = static_cast<uint64_t>(scaled + 0.5);
+
+        if ((magnitude != 0) && std::signbit(value))
+        {
+            if (first == last)
+            {
+                return Detail::Terminate(buffer, first, false);
+            }
+            *first++ = '-';
+        }
+
+        auto result = std::to_chars(first, last, magnitude / scale);
+
+        if ((result.ec == std::errc{}) && (decimalDigits > 0))
+        {
+            if (result.ptr == last)
+            {
+                return Detail::Terminate(buffer, result.ptr, false);
+            }
+            *result.ptr++ = '.';
+
+            result = Detail::ToCharsPadded(result.ptr, last, magnitude % scale, decimalDigits);
+        }
+
+        return Detail::Terminate(buffer, result.ptr, (result.ec == std::errc{}));
+    }
+
+    // E.g. uint16_t{0xAB} yields "0x00AB"; i.e. two uppercase digits per
+    // byte of T.
+    template <std::integral T>
+    std::string_view FormatHex(std::span<char> buffer, const T& value)
+    {
+        if (buffer.size() < 3)
+        {
+            return Detail::Terminate(buffer, buffer.data(), false);
+        }
+
+        char* const last = buffer.data() + buffer.size() - 1; // Room for the NUL.
+
+        buffer[0] = '0';
+        buffer[1] = 'x';
+
+        const auto unsignedValue = static_cast<std::make_unsigned_t<T>>(value);
+        const auto [end, error]  = Detail::ToCharsPadded(buffer.data() + 2, last, unsignedValue,
+                                                         sizeof(T) * 2, 16);
+
+        std::transform(buffer.data() + 2, end, buffer.data() + 2, [](const char& c)
+        {
+            return ((c >= 'a') && (c <= 'f')) ? static_cast<char>(c - 'a' + 'A') : c;
+        });
+
+        return Detail::Terminate(buffer, end, (error == std::errc{}));
+    }
+
+    // E.g. an SPI frame {0xB4, 0x00, 0x1F, 0x6F} yields "0xB4001F6F".
+    inline std::string_view FormatHexBytes(std::span<char> buffer, std::span<const uint8_t> bytes)
+    {
+        const auto required = 2 + (2 * bytes.size()) + 1;
+
+        if (buffer.size() < required)
+        {
+            return Detail::Terminate(buffer, buffer.data(), false);
+        }
+
+        constexpr std::string_view HEX_DIGITS{"0123456789ABCDEF"};
+
+        char* first = buffer.data();
+        *first++ = '0';
+        *first++ = 'x';
+
+        for (const auto& byte : bytes)
+        {
+            *first++ = HEX_DIGITS[byte >> 4];
+            *first++ = HEX_DIGITS[byte & 0x0F];
+        }
+
+        return Detail::Terminate(buffer, first, true);
+    }
+
+    // Most significant bit first, as per std::bitset<>::to_string().
+    template <std::unsigned_integral T>
+    std::string_view FormatBinary(std::span<char> buffer, const T& value)
+    {
+        constexpr auto DIGITS = std::numeric_limits<T>::digits;
+
+        if (buffer.size() < (DIGITS + 1))
+        {
+            return Detail::Terminate(buffer, buffer.data(), false);
+        }
+
+        for (int bit = 0; bit < DIGITS; ++bit)
+        {
+            buffer[bit] = ((value >> (DIGITS - 1 - bit)) & 1) ? '1' : '0';
+        }
+
+        return Detail::Terminate(buffer, buffer.data() + DIGITS, true);
+    }
+
+} // End of namespace Formatting.
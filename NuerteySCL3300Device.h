@@ -52,12 +52,21 @@
 //
 // https://www.murata.com/-/media/webrenewal/products/sensor/pdf/datasheet/datasheet_scl3300-d01.ashx?la=en-sg
 
+#include <bit>
+#include <atomic>
 #include <system_error>
+#include <string_view>
 
 #include "Protocol.h" 
+#include "SPITransport.h" 
+#include "Conversions.h" 
+#include "EventLog.h" 
 
 using namespace Utilities;
 using namespace ProtocolDefinitions;
+using namespace TransportPolicies;
+using namespace Conversions;
+using namespace Diagnostics;
 
 // \"Table 7 describes the DC characteristics of SCL3300-D01 sensor SPI I/O pins. Supply
 // voltage is 3.3 V unless otherwise specified. Current flowing into the circuit has a positive
@@ -100,7 +109,7 @@ enum class [[nodiscard]] SensorStatus_t : int8_t
     SUCCESS                                                  =   0,
     
     // Should never happen due to provision of proactive static assert,
-    // ProtocolDefinitions::AssertValidSPICommandFrame<T>(). Still, 
+    // ProtocolDefinitions::AssertValidSPICommandFrame<V>(). Still, 
     // trying to be comprehensive. 
     ERROR_INVALID_COMMAND_FRAME                              =  -1, 
                                                                 
@@ -127,7 +136,19 @@ enum class [[nodiscard]] SensorStatus_t : int8_t
     ERROR_STATUS_REGISTER_ACCELERATION_SIGNAL_PATH_SATURATED = -17,
     ERROR_STATUS_REGISTER_CLOCK_ERRORED                      = -18,
     ERROR_STATUS_REGISTER_DIGITAL_BLOCK_ERRORED_TYPE_2       = -19,
-    ERROR_STATUS_REGISTER_DIGITAL_BLOCK_ERRORED_TYPE_1       = -20   
+    ERROR_STATUS_REGISTER_DIGITAL_BLOCK_ERRORED_TYPE_1       = -20,
+    
+    ERROR_TRANSFER_IN_PROGRESS                               = -21,
+    ERROR_SAMPLING_PERIOD_TOO_SHORT                          = -22,
+    ERROR_SAMPLING_ENGINE_RUNNING                            = -23,
+    ERROR_EMPTY_CHANNEL_SET                                  = -24,
+    ERROR_EVENT_QUEUE_EXHAUSTED                              = -25,
+    
+    // \" If these do not reset the error, then possible component error
+    // has occurred and system needs to be shut down and part returned to
+    // supplier. \"
+    ERROR_RECOVERY_ATTEMPTS_EXHAUSTED                        = -26,
+    ERROR_INVALID_DUTY_CYCLE                                 = -27
 };
 
 // Register for implicit conversion to error_code:
@@ -152,9 +173,10 @@ const char* SCL3300ErrorCategory::name() const noexcept
     return "SCL3300-Sensor-Mbed";
 }
 
-std::string SCL3300ErrorCategory::message(int ev) const
+// The messages are string literals, hence also NUL-terminated.
+constexpr std::string_view ToString(const SensorStatus_t& status)
 {
-    switch (ToEnum<SensorStatus_t>(ev))
+    switch (status)
     {
         case SensorStatus_t::SUCCESS:
             return "Success - no errors";
@@ -218,12 +240,38 @@ std::string SCL3300ErrorCategory::message(int ev) const
 
         case SensorStatus_t::ERROR_STATUS_REGISTER_DIGITAL_BLOCK_ERRORED_TYPE_1:
             return "Digital block error type 1 - SW or HW reset needed";   
+
+        case SensorStatus_t::ERROR_TRANSFER_IN_PROGRESS:
+            return "SPI bus busy - An asynchronous transfer is still in progress";
+
+        case SensorStatus_t::ERROR_SAMPLING_PERIOD_TOO_SHORT:
+            return "Sampling period is shorter than the sensor output data rate permits";
+
+        case SensorStatus_t::ERROR_SAMPLING_ENGINE_RUNNING:
+            return "Sampling engine is running - Stop it before reconfiguring";
+
+        case SensorStatus_t::ERROR_EMPTY_CHANNEL_SET:
+            return "No channels were selected for sampling";
+
+        case SensorStatus_t::ERROR_EVENT_QUEUE_EXHAUSTED:
+            return "Event queue exhausted - Could not post or schedule an event";
+
+        case SensorStatus_t::ERROR_RECOVERY_ATTEMPTS_EXHAUSTED:
+            return "Software resets did not clear the error - HW reset needed, possible component error";
+
+        case SensorStatus_t::ERROR_INVALID_DUTY_CYCLE:
+            return "Duty cycle invalid - Burst must be non-empty and its wake-ups periodic";
                         
         default:
             return "(unrecognized error)";
     }
 }
 
+std::string SCL3300ErrorCategory::message(int ev) const
+{
+    return std::string(ToString(ToEnum<SensorStatus_t>(ev)));
+}
+
 inline const std::error_category& scl3300_error_category()
 {
     static SCL3300ErrorCategory instance;
@@ -240,6 +288,120 @@ inline auto make_error_condition(SensorStatus_t e)
     return std::error_condition(ToUnderlyingType(e), scl3300_error_category());
 }
 
+// As per std::error_code::message(), albeit without constructing a
+// std::string upon every call.
+inline const char* GetErrorMessage(const std::error_code& error)
+{
+    if (error.category() == scl3300_error_category())
+    {
+        return ToString(static_cast<SensorStatus_t>(error.value())).data();
+    }
+
+    return error.category().name();
+}
+
+// Formats one deferred event; i.e. from the low-priority logging thread.
+inline void PrintLogEvent(const Diagnostics::LogEvent_t& event)
+{
+    if (event.m_Event >= Diagnostics::DRIVER_EVENTS.size())
+    {
+        printf("[%10lu us] Unrecognized event [%u]\n", 
+               static_cast<unsigned long>(event.m_TimestampMicroSecs),
+               static_cast<unsigned>(event.m_Event));
+        return;
+    }
+
+    const auto& descriptor = Diagnostics::DRIVER_EVENTS[event.m_Event];
+    const auto  severity   = Diagnostics::ToString(static_cast<Diagnostics::Severity_t>(event.m_Severity));
+
+    printf("[%10lu us] %.*s %.*s: ", 
+           static_cast<unsigned long>(event.m_TimestampMicroSecs),
+           static_cast<int>(severity.size()), severity.data(),
+           static_cast<int>(descriptor.m_Name.size()), descriptor.m_Name.data());
+    printf(descriptor.m_Format, 
+           static_cast<long>(event.m_Arguments[0]), 
+           static_cast<long>(event.m_Arguments[1]));
+
+    if (descriptor.m_HasErrorCode)
+    {
+        printf(" -> %s", ToString(static_cast<SensorStatus_t>(event.m_Arguments[0])).data());
+    }
+
+    printf("\n");
+}
+
+// =====================================================================
+// The ERR_FLAG and command registers are decoded bit by bit. Each bit's
+// description lives in a constexpr table in flash, indexed by the bit
+// number, so that a lookup is one count-trailing-zeros and one load.
+//
+// Register contents are kept as a FlagSet_t, i.e. the bitmask itself,
+// rather than reduced to a single reason; several faults may well be
+// flagged at once, and the first one found is not necessarily the one
+// that matters.
+template <typename E>
+    requires (std::is_enum_v<E> && std::is_same_v<std::underlying_type_t<E>, uint16_t>)
+class FlagSet_t
+{
+public:
+    // Yields each set bit as its single-bit enumerator, lowest first.
+    class Iterator
+    {
+    public:
+        constexpr explicit Iterator(const uint16_t& remaining) : m_Remaining(remaining) {}
+
+        constexpr E operator*() const
+        {
+            return static_cast<E>(m_Remaining & static_cast<uint16_t>(-m_Remaining));
+        }
+
+        constexpr Iterator& operator++()
+        {
+            m_Remaining &= static_cast<uint16_t>(m_Remaining - 1); // Clear the lowest set bit.
+            return *this;
+        }
+
+        constexpr bool operator==(const Iterator& other) const = default;
+
+    private:
+        uint16_t m_Remaining;
+    };
+
+    constexpr FlagSet_t() = default;
+    constexpr explicit FlagSet_t(const uint16_t& bits) : m_Bits(bits) {}
+
+    constexpr uint16_t    GetBits() const { return m_Bits; }
+    constexpr bool        IsEmpty() const { return (m_Bits == 0); }
+    constexpr std::size_t GetCount() const { return static_cast<std::size_t>(std::popcount(m_Bits)); }
+
+    constexpr bool Contains(const E& reason) const
+    {
+        return ((m_Bits & ToUnderlyingType(reason)) != 0);
+    }
+
+    constexpr Iterator begin() const { return Iterator{m_Bits}; }
+    constexpr Iterator end() const { return Iterator{0}; }
+
+private:
+    uint16_t m_Bits{0};
+};
+
+constexpr std::size_t REGISTER_BIT_COUNT = 16;
+
+using BitDescriptions_t = std::array<std::string_view, REGISTER_BIT_COUNT>;
+
+constexpr std::string_view NO_ERRORS_DESCRIPTION{"\"No errors present\""};
+
+// Describes a single-bit enumerator; zero being the absence of any.
+template <typename E>
+constexpr std::string_view DescribeBit(const BitDescriptions_t& descriptions, const E& reason,
+                                       const std::string_view& none = NO_ERRORS_DESCRIPTION)
+{
+    const auto value = ToUnderlyingType(reason);
+
+    return (value == 0) ? none : descriptions[std::countr_zero(value)];
+}
+
 // =====================================================================
 enum class ErrorFlag1Reason_t : uint16_t
 {
@@ -262,39 +424,35 @@ enum class ErrorFlag1Reason_t : uint16_t
     RESERVED_4       = 32768
 };
 
-using ErrorFlag1ReasonMap_t = std::map<ErrorFlag1Reason_t, std::string>;
-using IndexElementFlag1_t   = ErrorFlag1ReasonMap_t::value_type;
-
-inline static auto make_error_flag1_reason_map()
+using ErrorFlag1Set_t = FlagSet_t<ErrorFlag1Reason_t>;
+
+// Indexed by bit number.
+constexpr BitDescriptions_t ERROR_FLAG1_REASONS{{
+    "\"Error in non-volatile memory\"",
+    "\"Signal saturated at C2V - Bit 1\"",
+    "\"Signal saturated at C2V - Bit 2\"",
+    "\"Signal saturated at C2V - Bit 3\"",
+    "\"Signal saturated at C2V - Bit 4\"",
+    "\"Signal saturated at C2V - Bit 5\"",
+    "\"Signal saturated at C2V - Bit 6\"",
+    "\"Signal saturated at C2V - Bit 7\"",
+    "\"Signal saturated at C2V - Bit 8\"",
+    "\"Signal saturated at C2V - Bit 9\"",
+    "\"Signal saturated at C2V - Bit 10\"",
+    "\"Signal saturated at A2D\"",
+    "\"Reserved - Bit 1\"",
+    "\"Reserved - Bit 2\"",
+    "\"Reserved - Bit 3\"",
+    "\"Reserved - Bit 4\""}};
+
+constexpr std::string_view ToString(const ErrorFlag1Reason_t & key)
 {
-    ErrorFlag1ReasonMap_t rMap;
-    
-    rMap.insert(IndexElementFlag1_t(ErrorFlag1Reason_t::SUCCESS_NO_ERROR, std::string("\"No errors present\"")));
-    rMap.insert(IndexElementFlag1_t(ErrorFlag1Reason_t::MEM, std::string("\"Error in non-volatile memory\"")));
-    rMap.insert(IndexElementFlag1_t(ErrorFlag1Reason_t::AFE_SAT_BIT_1, std::string("\"Signal saturated at C2V - Bit 1\"")));
-    rMap.insert(IndexElementFlag1_t(ErrorFlag1Reason_t::AFE_SAT_BIT_2, std::string("\"Signal saturated at C2V - Bit 2\"")));
-    rMap.insert(IndexElementFlag1_t(ErrorFlag1Reason_t::AFE_SAT_BIT_3, std::string("\"Signal saturated at C2V - Bit 3\"")));
-    rMap.insert(IndexElementFlag1_t(ErrorFlag1Reason_t::AFE_SAT_BIT_4, std::string("\"Signal saturated at C2V - Bit 4\"")));
-    rMap.insert(IndexElementFlag1_t(ErrorFlag1Reason_t::AFE_SAT_BIT_5, std::string("\"Signal saturated at C2V - Bit 5\"")));
-    rMap.insert(IndexElementFlag1_t(ErrorFlag1Reason_t::AFE_SAT_BIT_6, std::string("\"Signal saturated at C2V - Bit 6\"")));
-    rMap.insert(IndexElementFlag1_t(ErrorFlag1Reason_t::AFE_SAT_BIT_7, std::string("\"Signal saturated at C2V - Bit 7\"")));
-    rMap.insert(IndexElementFlag1_t(ErrorFlag1Reason_t::AFE_SAT_BIT_8, std::string("\"Signal saturated at C2V - Bit 8\"")));
-    rMap.insert(IndexElementFlag1_t(ErrorFlag1Reason_t::AFE_SAT_BIT_9, std::string("\"Signal saturated at C2V - Bit 9\"")));
-    rMap.insert(IndexElementFlag1_t(ErrorFlag1Reason_t::AFE_SAT_BIT_10, std::string("\"Signal saturated at C2V - Bit 10\"")));
-    rMap.insert(IndexElementFlag1_t(ErrorFlag1Reason_t::ADC_SAT, std::string("\"Signal saturated at A2D\"")));
-    rMap.insert(IndexElementFlag1_t(ErrorFlag1Reason_t::RESERVED_1, std::string("\"Reserved - Bit 1\"")));
-    rMap.insert(IndexElementFlag1_t(ErrorFlag1Reason_t::RESERVED_2, std::string("\"Reserved - Bit 2\"")));
-    rMap.insert(IndexElementFlag1_t(ErrorFlag1Reason_t::RESERVED_3, std::string("\"Reserved - Bit 3\"")));
-    rMap.insert(IndexElementFlag1_t(ErrorFlag1Reason_t::RESERVED_4, std::string("\"Reserved - Bit 4\"")));
-
-    return rMap;
+    return DescribeBit(ERROR_FLAG1_REASONS, key);
 }
 
-static ErrorFlag1ReasonMap_t gs_ErrorFlag1ReasonMap = make_error_flag1_reason_map();
-
-inline std::string ToString(const ErrorFlag1Reason_t & key)
+constexpr ErrorFlag1Set_t DecodeErrorFlag1(const uint16_t& errorFlag)
 {
-    return (gs_ErrorFlag1ReasonMap.at(key));
+    return ErrorFlag1Set_t{errorFlag};
 }
 
 // =====================================================================
@@ -319,39 +477,35 @@ enum class ErrorFlag2Reason_t : uint16_t
     RESERVED_15      = 32768
 };
 
-using ErrorFlag2ReasonMap_t = std::map<ErrorFlag2Reason_t, std::string>;
-using IndexElementFlag2_t   = ErrorFlag2ReasonMap_t::value_type;
-
-inline static auto make_error_flag2_reason_map()
+using ErrorFlag2Set_t = FlagSet_t<ErrorFlag2Reason_t>;
+
+// Indexed by bit number.
+constexpr BitDescriptions_t ERROR_FLAG2_REASONS{{
+    "\"Clock error\"",
+    "\"Temperature signal path saturated\"",
+    "\"Analog power error 2\"",
+    "\"Reference voltage error\"",
+    "\"Digital power error - SW or HW reset needed\"",
+    "\"Analog power error\"",
+    "\"Reserved - Bit 6\"",
+    "\"Memory CRC check failed\"",
+    "\"Device in power down mode\"",
+    "\"Operation mode changed by user\"",
+    "\"Reserved - Bit 10\"",
+    "\"Supply voltage error\"",
+    "\"Analog ground connection error\"",
+    "\"A - External capacitor connection error\"",
+    "\"D - External capacitor connection error\"",
+    "\"Reserved - Bit 15\""}};
+
+constexpr std::string_view ToString(const ErrorFlag2Reason_t & key)
 {
-    ErrorFlag2ReasonMap_t rMap;
-    
-    rMap.insert(IndexElementFlag2_t(ErrorFlag2Reason_t::SUCCESS_NO_ERROR, std::string("\"No errors present\"")));
-    rMap.insert(IndexElementFlag2_t(ErrorFlag2Reason_t::CLK, std::string("\"Clock error\"")));
-    rMap.insert(IndexElementFlag2_t(ErrorFlag2Reason_t::TEMP_SAT, std::string("\"Temperature signal path saturated\"")));
-    rMap.insert(IndexElementFlag2_t(ErrorFlag2Reason_t::APWR_2, std::string("\"Analog power error 2\"")));
-    rMap.insert(IndexElementFlag2_t(ErrorFlag2Reason_t::VREF, std::string("\"Reference voltage error\"")));
-    rMap.insert(IndexElementFlag2_t(ErrorFlag2Reason_t::DPWR, std::string("\"Digital power error - SW or HW reset needed\"")));
-    rMap.insert(IndexElementFlag2_t(ErrorFlag2Reason_t::APWR, std::string("\"Analog power error\"")));
-    rMap.insert(IndexElementFlag2_t(ErrorFlag2Reason_t::RESERVED_6, std::string("\"Reserved - Bit 6\"")));
-    rMap.insert(IndexElementFlag2_t(ErrorFlag2Reason_t::MEMORY_CRC, std::string("\"Memory CRC check failed\"")));
-    rMap.insert(IndexElementFlag2_t(ErrorFlag2Reason_t::PD, std::string("\"Device in power down mode\"")));
-    rMap.insert(IndexElementFlag2_t(ErrorFlag2Reason_t::MODE_CHANGE, std::string("\"Operation mode changed by user\"")));
-    rMap.insert(IndexElementFlag2_t(ErrorFlag2Reason_t::RESERVED_10, std::string("\"Reserved - Bit 10\"")));
-    rMap.insert(IndexElementFlag2_t(ErrorFlag2Reason_t::VDD, std::string("\"Supply voltage error\"")));
-    rMap.insert(IndexElementFlag2_t(ErrorFlag2Reason_t::AGND, std::string("\"Analog ground connection error\"")));
-    rMap.insert(IndexElementFlag2_t(ErrorFlag2Reason_t::A_EXT_C, std::string("\"A - External capacitor connection error\"")));
-    rMap.insert(IndexElementFlag2_t(ErrorFlag2Reason_t::D_EXT_C, std::string("\"D - External capacitor connection error\"")));
-    rMap.insert(IndexElementFlag2_t(ErrorFlag2Reason_t::RESERVED_15, std::string("\"Reserved - Bit 15\"")));
-
-    return rMap;
+    return DescribeBit(ERROR_FLAG2_REASONS, key);
 }
 
-static ErrorFlag2ReasonMap_t gs_ErrorFlag2ReasonMap = make_error_flag2_reason_map();
-
-inline std::string ToString(const ErrorFlag2Reason_t & key)
+constexpr ErrorFlag2Set_t DecodeErrorFlag2(const uint16_t& errorFlag)
 {
-    return (gs_ErrorFlag2ReasonMap.at(key));
+    return ErrorFlag2Set_t{errorFlag};
 }
 
 // =====================================================================
@@ -377,40 +531,186 @@ enum class CommandRegisterValue_t : uint16_t
     RESERVED_BIT_15     = 32768
 };
 
-using CommandRegisterValueMap_t = std::map<CommandRegisterValue_t, std::string>;
-using IndexElementCommand_t     = CommandRegisterValueMap_t::value_type;
+// Bits [1:0] are not flags but a field; i.e. the operation mode.
+constexpr uint16_t OPERATION_MODE_FIELD_MASK = 0x0003;
+
+constexpr std::array<std::string_view, 4> OPERATION_MODE_DESCRIPTIONS{{
+    "\"MODE_1 -> SCL3300 Operation Mode 1\"",
+    "\"MODE_2 -> SCL3300 Operation Mode 2\"",
+    "\"MODE_3 -> SCL3300 Operation Mode 3\"",
+    "\"MODE_4 -> SCL3300 Operation Mode 4\""}};
+
+// Indexed by bit number; bits [1:0] are described by the mode instead.
+constexpr BitDescriptions_t COMMAND_REGISTER_VALUES{{
+    "",
+    "",
+    "\"PD -> Power Down\"",
+    "\"FACTORY_USE -> Factory use - Bit 3\"",
+    "\"FACTORY_USE -> Factory use - Bit 4\"",
+    "\"SW_RST -> Software (SW) Reset\"",
+    "\"FACTORY_USE -> Factory use - Bit 6\"",
+    "\"FACTORY_USE -> Factory use - Bit 7\"",
+    "\"RESERVED -> Reserved - Bit 8\"",
+    "\"RESERVED -> Reserved - Bit 9\"",
+    "\"RESERVED -> Reserved - Bit 10\"",
+    "\"RESERVED -> Reserved - Bit 11\"",
+    "\"RESERVED -> Reserved - Bit 12\"",
+    "\"RESERVED -> Reserved - Bit 13\"",
+    "\"RESERVED -> Reserved - Bit 14\"",
+    "\"RESERVED -> Reserved - Bit 15\""}};
+
+constexpr std::string_view ToString(const CommandRegisterValue_t & key)
+{
+    const auto value = ToUnderlyingType(key);
+
+    return ((value & ~OPERATION_MODE_FIELD_MASK) == 0) ? OPERATION_MODE_DESCRIPTIONS[value]
+                                                       : COMMAND_REGISTER_VALUES[std::countr_zero(value)];
+}
+
+struct CommandRegisterDecoding_t
+{
+    CommandRegisterValue_t             m_Mode;
+    FlagSet_t<CommandRegisterValue_t>  m_Flags; // PD, SW_RST, factory use and reserved bits.
+};
+
+constexpr CommandRegisterDecoding_t DecodeCommandRegister(const uint16_t& commandValue)
+{
+    return CommandRegisterDecoding_t{
+        static_cast<CommandRegisterValue_t>(commandValue & OPERATION_MODE_FIELD_MASK),
+        FlagSet_t<CommandRegisterValue_t>{static_cast<uint16_t>(commandValue & ~OPERATION_MODE_FIELD_MASK)}};
+}
+
+static_assert(DecodeErrorFlag2(0x0011).GetCount() == 2);
+static_assert(DecodeErrorFlag2(0x0011).Contains(ErrorFlag2Reason_t::DPWR));
+static_assert(*DecodeErrorFlag1(0x0804).begin() == ErrorFlag1Reason_t::AFE_SAT_BIT_2);
+static_assert(ToString(ErrorFlag2Reason_t::RESERVED_15) == "\"Reserved - Bit 15\"");
+static_assert(DecodeCommandRegister(0x0007).m_Mode == CommandRegisterValue_t::MODE_4);
+static_assert(ToString(CommandRegisterValue_t::SW_RST) == "\"SW_RST -> Software (SW) Reset\"");
+
+// =====================================================================
+// \" 6.3 Status Summary
+//
+// STATUS register contains combination of the information in the
+// ERR_FLAG1 and ERR_FLAG2 registers. \"
+//
+// Bits [15:10] are reserved and masked out.
+enum class StatusFlag_t : uint16_t
+{
+    SUCCESS_NO_ERROR =     0,
+    PIN_CONT         =     1,
+    MODE_CHANGE      =     2,
+    PD               =     4,
+    MEM              =     8,
+    PWR              =    16,
+    TEMP_SAT         =    32,
+    SAT              =    64,
+    CLK              =   128,
+    DIGI2            =   256,
+    DIGI1            =   512
+};
+
+using StatusFlagSet_t = FlagSet_t<StatusFlag_t>;
+
+constexpr uint16_t    STATUS_FLAGS_MASK     = 0x03FF;
+constexpr std::size_t NUMBER_OF_STATUS_FLAGS = std::popcount(STATUS_FLAGS_MASK);
+
+// Indexed by bit number.
+constexpr std::array<SensorStatus_t, NUMBER_OF_STATUS_FLAGS> STATUS_FLAG_ERRORS{{
+    SensorStatus_t::ERROR_STATUS_REGISTER_PIN_CONTINUITY,
+    SensorStatus_t::ERROR_STATUS_REGISTER_MODE_CHANGED,
+    SensorStatus_t::ERROR_STATUS_REGISTER_DEVICE_POWERED_DOWN,
+    SensorStatus_t::ERROR_STATUS_REGISTER_NON_VOLATILE_MEMORY_ERRORED,
+    SensorStatus_t::ERROR_STATUS_REGISTER_SAFE_VOLTAGE_LEVELS_EXCEEDED,
+    SensorStatus_t::ERROR_STATUS_REGISTER_TEMPERATURE_SIGNAL_PATH_SATURATED,
+    SensorStatus_t::ERROR_STATUS_REGISTER_ACCELERATION_SIGNAL_PATH_SATURATED,
+    SensorStatus_t::ERROR_STATUS_REGISTER_CLOCK_ERRORED,
+    SensorStatus_t::ERROR_STATUS_REGISTER_DIGITAL_BLOCK_ERRORED_TYPE_2,
+    SensorStatus_t::ERROR_STATUS_REGISTER_DIGITAL_BLOCK_ERRORED_TYPE_1}};
+
+constexpr SensorStatus_t ToSensorStatus(const StatusFlag_t& flag)
+{
+    const auto value = ToUnderlyingType(flag);
+
+    return (value == 0) ? SensorStatus_t::SUCCESS : STATUS_FLAG_ERRORS[std::countr_zero(value)];
+}
+
+constexpr std::string_view ToString(const StatusFlag_t& flag)
+{
+    return ToString(ToSensorStatus(flag));
+}
+
+// A mask and nothing else; every active flag is retained.
+constexpr StatusFlagSet_t DecodeStatusSummary(const uint16_t& status)
+{
+    return StatusFlagSet_t{static_cast<uint16_t>(status & STATUS_FLAGS_MASK)};
+}
+
+// The single most significant error, for those callers which want an
+// std::error_code; i.e. the lowest set bit, per the original priority.
+constexpr SensorStatus_t ToSensorStatus(const StatusFlagSet_t& flags)
+{
+    return flags.IsEmpty() ? SensorStatus_t::SUCCESS : STATUS_FLAG_ERRORS[std::countr_zero(flags.GetBits())];
+}
+
+// =====================================================================
+// Batch decoding of recorded STATUS words, e.g. for fleet analytics.
+// Both kernels are branch-free loops which the compiler vectorizes.
+// =====================================================================
 
-inline static auto make_command_register_value_map()
+// Every flag seen anywhere within 'statuses'.
+inline StatusFlagSet_t AccumulateStatusFlags(std::span<const uint16_t> statuses)
 {
-    CommandRegisterValueMap_t cMap;
+    uint16_t accumulated = 0;
 
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::MODE_1, std::string("\"MODE_1 -> SCL3300 Operation Mode 1\"")));    
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::MODE_2, std::string("\"MODE_2 -> SCL3300 Operation Mode 2\"")));
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::MODE_3, std::string("\"MODE_3 -> SCL3300 Operation Mode 3\"")));
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::MODE_4, std::string("\"MODE_4 -> SCL3300 Operation Mode 4\"")));
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::PD, std::string("\"PD -> Power Down\"")));
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::FACTORY_USE_BIT_3, std::string("\"FACTORY_USE -> Factory use - Bit 3\"")));
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::FACTORY_USE_BIT_4, std::string("\"FACTORY_USE -> Factory use - Bit 4\"")));
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::SW_RST, std::string("\"SW_RST -> Software (SW) Reset\"")));
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::FACTORY_USE_BIT_6, std::string("\"FACTORY_USE -> Factory use - Bit 6\"")));
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::FACTORY_USE_BIT_7, std::string("\"FACTORY_USE -> Factory use - Bit 7\"")));
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::RESERVED_BIT_8, std::string("\"RESERVED -> Reserved - Bit 8\"")));
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::RESERVED_BIT_9, std::string("\"RESERVED -> Reserved - Bit 9\"")));
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::RESERVED_BIT_10, std::string("\"RESERVED -> Reserved - Bit 10\"")));
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::RESERVED_BIT_11, std::string("\"RESERVED -> Reserved - Bit 11\"")));
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::RESERVED_BIT_12, std::string("\"RESERVED -> Reserved - Bit 12\"")));
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::RESERVED_BIT_13, std::string("\"RESERVED -> Reserved - Bit 13\"")));
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::RESERVED_BIT_14, std::string("\"RESERVED -> Reserved - Bit 14\"")));
-    cMap.insert(IndexElementCommand_t(CommandRegisterValue_t::RESERVED_BIT_15, std::string("\"RESERVED -> Reserved - Bit 15\"")));
+    for (const auto& status : statuses)
+    {
+        accumulated |= status;
+    }
 
-    return cMap;
+    return DecodeStatusSummary(accumulated);
 }
 
-static CommandRegisterValueMap_t gs_CommandRegisterValueMap = make_command_register_value_map();
+// Indexed by bit number, as per STATUS_FLAG_ERRORS.
+using StatusFlagCounts_t = std::array<uint32_t, NUMBER_OF_STATUS_FLAGS>;
+
+// Adds, per flag, the number of words within 'statuses' in which it is
+// set; i.e. 'counts' may be accumulated over several spans.
+inline void CountStatusFlags(std::span<const uint16_t> statuses, StatusFlagCounts_t& counts)
+{
+    // One pass per flag, each a plain sum reduction, vectorizes far
+    // better than ten scattered increments per word.
+    for (std::size_t bit = 0; bit < NUMBER_OF_STATUS_FLAGS; ++bit)
+    {
+        uint32_t count = 0;
+
+        for (const auto& status : statuses)
+        {
+            count += (status >> bit) & 1U;
+        }
+
+        counts[bit] += count;
+    }
+}
 
-inline std::string ToString(const CommandRegisterValue_t & key)
+static_assert(DecodeStatusSummary(0xFC12).GetBits() == 0x0012);
+static_assert(ToSensorStatus(DecodeStatusSummary(0x0300)) 
+              == SensorStatus_t::ERROR_STATUS_REGISTER_DIGITAL_BLOCK_ERRORED_TYPE_2);
+static_assert(ToSensorStatus(DecodeStatusSummary(0x0000)) == SensorStatus_t::SUCCESS);
+
+// Those flags whose descriptions above call for a \" SW or HW reset \".
+// A mode change is only ever expected during start-up, before STATUS is
+// cleared; thereafter it was unrequested.
+constexpr uint16_t RESET_REQUIRED_STATUS_FLAGS = ToUnderlyingType(StatusFlag_t::MODE_CHANGE)
+                                               | ToUnderlyingType(StatusFlag_t::PD)
+                                               | ToUnderlyingType(StatusFlag_t::MEM)
+                                               | ToUnderlyingType(StatusFlag_t::PWR)
+                                               | ToUnderlyingType(StatusFlag_t::CLK)
+                                               | ToUnderlyingType(StatusFlag_t::DIGI2)
+                                               | ToUnderlyingType(StatusFlag_t::DIGI1);
+
+constexpr bool IsResetRequired(const StatusFlagSet_t& flags)
 {
-    return (gs_CommandRegisterValueMap.at(key));
+    return ((flags.GetBits() & RESET_REQUIRED_STATUS_FLAGS) != 0);
 }
 
 // =====================================================================
@@ -427,39 +727,51 @@ struct Kelvin_t {};
 // operation acceleration outputs ACCX, ACCY, ACCZ are read in every cycle using
 // sensor ODR. It is necessary to read STATUS register only if return status (RS) indicates
 // error. \"
+constexpr uint32_t SENSOR_OUTPUT_DATA_RATE_HZ = 2000;
 
-template<typename T>
-using SensorAttribute_t = std::tuple<SPICommandFrame_t, SPICommandFrame_t, T, std::string>;
+// Sampling any faster than the ODR would merely re-read the same register
+// contents. The ODR is the same in every operation mode; only the low pass
+// filter differs.
+constexpr MicroSecs_t GetMinimumSamplingPeriod(const OperationMode_t& /*mode*/)
+{
+    return MicroSecs_t{1000000 / SENSOR_OUTPUT_DATA_RATE_HZ};
+}
 
-// Tuple to hold raw sensor data. We must ensure to populate all 
-// these each time we read a set of sensor data:
+// The channels of the sensor data block, in sweep order. Sourced from 
+// 'datasheet_scl3300-d01.pdf' section:
 //
-//    // Culprit register values of interest. Sourced from 
-//    // 'datasheet_scl3300-d01.pdf' section:
-//    //
-//    // /" 6.1 Sensor Data Block
-//    //
-//    // Table 18 Sensor data block description \"
-//    SensorAttribute_t<int16_t >    m_AccelerationXAxis;
-//    SensorAttribute_t<int16_t >    m_AccelerationYAxis;
-//    SensorAttribute_t<int16_t >    m_AccelerationZAxis;
-//    SensorAttribute_t<int16_t >    m_SelfTestOutput;
-//    SensorAttribute_t<int16_t >    m_Temperature;
-//    SensorAttribute_t<int16_t >    m_AngleXAxis;
-//    SensorAttribute_t<int16_t >    m_AngleYAxis;
-//    SensorAttribute_t<int16_t >    m_AngleZAxis;
-//    SensorAttribute_t<uint16_t>    m_StatusSummary;
-//    SensorAttribute_t<uint16_t>    m_WhoAmI;
-using SCL3300SensorData_t = std::tuple<SensorAttribute_t<int16_t >,
-                                       SensorAttribute_t<int16_t >,
-                                       SensorAttribute_t<int16_t >,
-                                       SensorAttribute_t<int16_t >,
-                                       SensorAttribute_t<int16_t >,
-                                       SensorAttribute_t<int16_t >,
-                                       SensorAttribute_t<int16_t >,
-                                       SensorAttribute_t<int16_t >,
-                                       SensorAttribute_t<uint16_t>,
-                                       SensorAttribute_t<uint16_t> >;
+// /" 6.1 Sensor Data Block
+//
+// Table 18 Sensor data block description \"
+enum class Channel_t : uint8_t
+{
+    ACCELERATION_X_AXIS,
+    ACCELERATION_Y_AXIS,
+    ACCELERATION_Z_AXIS,
+    SELF_TEST_OUTPUT,
+    TEMPERATURE,
+    ANGLE_X_AXIS,
+    ANGLE_Y_AXIS,
+    ANGLE_Z_AXIS,
+    STATUS_SUMMARY,
+    WHO_AM_I,
+    NUMBER_OF_CHANNELS
+};
+
+constexpr std::size_t NUMBER_OF_CHANNELS = ToUnderlyingType(Channel_t::NUMBER_OF_CHANNELS);
+
+// Names are for diagnostics only, hence kept out of the samples.
+constexpr std::array<std::string_view, NUMBER_OF_CHANNELS> CHANNEL_NAMES{
+    "READ_ACCELERATION_X_AXIS",
+    "READ_ACCELERATION_Y_AXIS",
+    "READ_ACCELERATION_Z_AXIS",
+    "READ_SELF_TEST_OUTPUT",
+    "READ_TEMPERATURE",
+    "READ_ANGLE_X_AXIS",
+    "READ_ANGLE_Y_AXIS",
+    "READ_ANGLE_Z_AXIS",
+    "READ_STATUS_SUMMARY",
+    "READ_WHO_AM_I"};
 
 // \" 6 Register Definition
 //
@@ -476,18 +788,336 @@ using SCL3300SensorData_t = std::tuple<SensorAttribute_t<int16_t >,
 // \" User should not access Reserved nor Factory Use registers.
 // Power-cycle, reset and power down mode will reset all written
 // settings. \"
-SCL3300SensorData_t g_TheSensorData{
-    std::make_tuple(SWITCH_TO_BANK_1, READ_ACCELERATION_X_AXIS, 0, std::string("READ_ACCELERATION_X_AXIS")),
-    std::make_tuple(SWITCH_TO_BANK_1, READ_ACCELERATION_Y_AXIS, 0, std::string("READ_ACCELERATION_Y_AXIS")),
-    std::make_tuple(SWITCH_TO_BANK_1, READ_ACCELERATION_Z_AXIS, 0, std::string("READ_ACCELERATION_Z_AXIS")),
-    std::make_tuple(SWITCH_TO_BANK_1, READ_SELF_TEST_OUTPUT,    0, std::string("READ_SELF_TEST_OUTPUT")),
-    std::make_tuple(SWITCH_TO_BANK_1, READ_TEMPERATURE,         0, std::string("READ_TEMPERATURE")),
-    std::make_tuple(SWITCH_TO_BANK_0, READ_ANGLE_X_AXIS,        0, std::string("READ_ANGLE_X_AXIS")),
-    std::make_tuple(SWITCH_TO_BANK_0, READ_ANGLE_Y_AXIS,        0, std::string("READ_ANGLE_Y_AXIS")),
-    std::make_tuple(SWITCH_TO_BANK_0, READ_ANGLE_Z_AXIS,        0, std::string("READ_ANGLE_Z_AXIS")),
-    std::make_tuple(SWITCH_TO_BANK_1, READ_STATUS_SUMMARY,      0, std::string("READ_STATUS_SUMMARY")),
-    std::make_tuple(SWITCH_TO_BANK_0, READ_WHO_AM_I,            0, std::string("READ_WHO_AM_I"))};
+//
+// Per Table 18, the whole sensor data block (ACC_X...WHOAMI) resides in
+// register bank #0. Bank #1 only holds SERIAL1/SERIAL2, with SELBANK
+// being accessible from either bank.
+constexpr std::array<RegisterRead_t, NUMBER_OF_CHANNELS> CHANNEL_READS{{
+    MakeRegisterRead(RegisterAddress_t::ACC_X),
+    MakeRegisterRead(RegisterAddress_t::ACC_Y),
+    MakeRegisterRead(RegisterAddress_t::ACC_Z),
+    MakeRegisterRead(RegisterAddress_t::STO),
+    MakeRegisterRead(RegisterAddress_t::TEMP),
+    MakeRegisterRead(RegisterAddress_t::ANG_X),
+    MakeRegisterRead(RegisterAddress_t::ANG_Y),
+    MakeRegisterRead(RegisterAddress_t::ANG_Z),
+    MakeRegisterRead(RegisterAddress_t::STATUS),
+    MakeRegisterRead(RegisterAddress_t::WHOAMI)}};
+
+constexpr std::string_view ToString(const Channel_t& channel)
+{
+    return CHANNEL_NAMES[ToUnderlyingType(channel)];
+}
+
+// A subset of the sensor data block, bit N selecting channel N.
+using ChannelSet_t = std::bitset<NUMBER_OF_CHANNELS>;
+
+constexpr ChannelSet_t ALL_CHANNELS{(1ULL << NUMBER_OF_CHANNELS) - 1};
+
+template <typename... Channels>
+    requires (std::is_same_v<Channels, Channel_t> && ...)
+constexpr ChannelSet_t MakeChannelSet(const Channels&... channels)
+{
+    return ChannelSet_t{((1ULL << ToUnderlyingType(channels)) | ... | 0ULL)};
+}
 
+// A channel subset as a compile-time type list; e.g.
+//
+// constexpr ChannelList_t<Channel_t::ANGLE_X_AXIS,
+//                         Channel_t::ANGLE_Y_AXIS,
+//                         Channel_t::ANGLE_Z_AXIS> LEVELING_CHANNELS{};
+template <Channel_t... Channels>
+struct ChannelList_t {};
+
+template <Channel_t... Channels>
+consteval bool AreDistinctChannels()
+{
+    constexpr std::array<Channel_t, sizeof...(Channels)> channels{Channels...};
+
+    for (std::size_t i = 0; i < channels.size(); ++i)
+    {
+        for (std::size_t j = i + 1; j < channels.size(); ++j)
+        {
+            if (channels[i] == channels[j])
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+template <Channel_t... Channels>
+concept ValidChannelList = (sizeof...(Channels) > 0)
+                        && ((Channels < Channel_t::NUMBER_OF_CHANNELS) && ...)
+                        && AreDistinctChannels<Channels...>();
+
+// Everything needed to read a channel subset, composed at compile time:
+// the reads, in the order given, and the pipelined frame trains for the
+// two cases which can arise at runtime. Namely, bank #0 being known to be
+// active (always so after any prior burst) or not.
+template <Channel_t... Channels>
+    requires ValidChannelList<Channels...>
+struct ChannelReadPlan_t
+{
+    static constexpr std::size_t NUMBER_OF_READS = sizeof...(Channels);
+
+    static constexpr std::array<Channel_t, NUMBER_OF_READS> CHANNELS{Channels...};
+
+    static constexpr std::array<RegisterRead_t, NUMBER_OF_READS> READS{
+        CHANNEL_READS[ToUnderlyingType(Channels)]...};
+
+    static constexpr FrameTrain_t TRAIN_FROM_BANK_0 = ComposeFrameTrain(READS, MemoryBank_t::BANK_0);
+    static constexpr FrameTrain_t TRAIN_FROM_UNKNOWN_BANK = ComposeFrameTrain(READS, std::nullopt);
+
+    // N reads in N+1 frames, as the sensor data block lies wholly in bank #0.
+    static_assert(TRAIN_FROM_BANK_0.m_Length == (NUMBER_OF_READS + 1));
+};
+
+// One sweep of the sensor data block. Trivially copyable, and free of 
+// any heap allocation, so that it may be copied verbatim into ring 
+// buffers or DMA-able memory.
+struct SCL3300Sample_t
+{
+    // Raw register contents in 2's complement. STATUS and WHOAMI are 
+    // unsigned and are to be read back via GetUnsigned().
+    std::array<int16_t, NUMBER_OF_CHANNELS> m_Raw;
+
+    // The 2-bit Return Status of each channel's response, packed with
+    // channel N occupying bits [2N+1:2N].
+    uint32_t                                m_ReturnStatus;
+
+    // Incremented with every completed sweep.
+    uint32_t                                m_SequenceNumber;
+
+    // When the sweep was initiated.
+    MonotonicClock_t::time_point            m_Timestamp;
+
+    constexpr int16_t Get(const Channel_t& channel) const
+    {
+        return m_Raw[ToUnderlyingType(channel)];
+    }
+
+    constexpr uint16_t GetUnsigned(const Channel_t& channel) const
+    {
+        return static_cast<uint16_t>(m_Raw[ToUnderlyingType(channel)]);
+    }
+
+    constexpr ReturnStatus_t GetReturnStatus(const Channel_t& channel) const
+    {
+        return static_cast<ReturnStatus_t>((m_ReturnStatus >> (2 * ToUnderlyingType(channel))) & 0x03);
+    }
+
+    constexpr void Set(const Channel_t& channel, const uint16_t& raw, const uint8_t& returnStatus)
+    {
+        const auto index = ToUnderlyingType(channel);
+        
+        m_Raw[index]    = static_cast<int16_t>(raw);
+        m_ReturnStatus  = (m_ReturnStatus & ~(0x03u << (2 * index)))
+                        | (static_cast<uint32_t>(returnStatus & 0x03) << (2 * index));
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<SCL3300Sample_t>);
+static_assert(2 * NUMBER_OF_CHANNELS <= std::numeric_limits<uint32_t>::digits);
+static_assert(sizeof(SCL3300Sample_t) <= 48);
+
+// Latency of each streamed single-channel read, so as to size the
+// deadline of a control loop built upon it. Latencies are also binned in
+// a power-of-two histogram: bin N counts reads of [2^(N-1), 2^N) us, the
+// last bin collecting everything longer. Pipeline primes are counted but
+// excluded from the latencies, which are those of the steady state.
+struct StreamStatistics_t
+{
+    static constexpr std::size_t NUMBER_OF_LATENCY_BINS = 12;
+
+    uint32_t    m_Reads{0};
+    uint32_t    m_Failures{0};
+    uint32_t    m_Primes{0};
+    MicroSecs_t m_MinimumLatency{MicroSecs_t::max()};
+    MicroSecs_t m_MaximumLatency{0};
+    MicroSecs_t m_TotalLatency{0};
+    std::array<uint32_t, NUMBER_OF_LATENCY_BINS> m_LatencyHistogram{};
+
+    MicroSecs_t GetMeanLatency() const
+    {
+        return (m_Reads == 0) ? MicroSecs_t{0} : (m_TotalLatency / m_Reads);
+    }
+
+    void Record(const MicroSecs_t& latency)
+    {
+        ++m_Reads;
+        m_MinimumLatency = std::min(m_MinimumLatency, latency);
+        m_MaximumLatency = std::max(m_MaximumLatency, latency);
+        m_TotalLatency  += latency;
+
+        const auto bin = std::bit_width(static_cast<uint64_t>(latency.count()));
+        ++m_LatencyHistogram[std::min<std::size_t>(bin, NUMBER_OF_LATENCY_BINS - 1)];
+    }
+};
+
+// A frame train in progress. Trains are transferred a frame at a time
+// via TransferNextFrame(), so that a bus scheduler may interleave the
+// trains of several devices sharing one SPI bus.
+struct FrameTrainCursor_t
+{
+    const FrameTrain_t*              m_Train{nullptr};
+    std::span<const RegisterRead_t>  m_Reads;
+    std::span<uint16_t>              m_Values;
+    std::span<uint8_t>               m_ReturnStatuses;
+
+    // Double-buffered so that the previous frame's response can be 
+    // validated during the inter-frame gap preceding the next frame.
+    std::array<SPICommandFrame_t, 2> m_Responses{};
+    std::size_t                      m_Index{0};
+
+    // The first failure; the rest of the train is collected regardless.
+    std::error_code                  m_Result{};
+
+    bool IsComplete() const { return ((m_Train == nullptr) || (m_Index >= m_Train->m_Length)); }
+};
+
+// A pipelined sweep of a channel set, from gathering its reads to
+// scattering their values into the latest sample. Refers to itself;
+// hence neither copyable nor movable.
+struct ChannelSweep_t
+{
+    ChannelSweep_t() = default;
+    ChannelSweep_t(const ChannelSweep_t&) = delete;
+    ChannelSweep_t& operator=(const ChannelSweep_t&) = delete;
+
+    ChannelSet_t                                   m_Channels{};
+    std::array<RegisterRead_t, NUMBER_OF_CHANNELS> m_Reads{};
+    std::array<uint16_t, NUMBER_OF_CHANNELS>       m_Values{};
+    std::array<uint8_t, NUMBER_OF_CHANNELS>        m_ReturnStatuses{};
+    FrameTrain_t                                   m_Train{};
+    FrameTrainCursor_t                             m_Cursor{};
+    MonotonicClock_t::time_point                   m_Timestamp{};
+};
+
+// How the start-up sequence decides that the signal path has settled.
+enum class StartupPolicy_t : uint8_t
+{
+    // Wait out the worst-case settling time of the mode, as tabulated.
+    DATASHEET_SETTLING,
+
+    // Poll the RS bits every READINESS_POLL_INTERVAL and proceed as soon
+    // as they read '01'; i.e. settled, and with STATUS cleared. Should
+    // they not within the tabulated settling time, fall back to the 
+    // above.
+    READINESS_POLLING
+};
+
+// Timing of the most recent start-up, measured from its first command
+// (wake-up or software reset). Units which power-cycle the sensor pay
+// for this latency in energy upon every cycle.
+struct StartupStatistics_t
+{
+    StartupPolicy_t m_Policy{StartupPolicy_t::DATASHEET_SETTLING};
+    uint32_t        m_ReadinessPolls{0};
+    bool            m_PollingTimedOut{false};
+    MicroSecs_t     m_ReadyLatency{0};        // Until STATUS was cleared.
+    MicroSecs_t     m_FirstSampleLatency{0};  // Until the first error-free sweep. Zero till then.
+};
+
+// The same sweep in integer engineering units, so that downstream filters
+// may stay in integer arithmetic throughout.
+struct FixedPointSample_t
+{
+    std::array<MilliG_t, 3>       m_AccelerationMilliG;      // X, Y, Z
+    std::array<CentiDegrees_t, 3> m_AngleCentiDegrees;       // X, Y, Z; signed, unlike Get*Axis()
+    CentiCelsius_t                m_TemperatureCentiCelsius;
+    uint32_t                      m_SequenceNumber;
+    MonotonicClock_t::time_point  m_Timestamp;
+};
+
+// Gathers one channel out of a run of samples into a contiguous column
+// of raw register values; i.e. the input of the Conversions:: batch 
+// kernels. Returns the number of values gathered.
+inline std::size_t ExtractChannel(std::span<const SCL3300Sample_t> samples,
+                                  const Channel_t& channel,
+                                  std::span<int16_t> raw)
+{
+    const auto count = std::min(samples.size(), raw.size());
+
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        raw[index] = samples[index].Get(channel);
+    }
+
+    return count;
+}
+
+// \" Table 23 Examples for STO Thresholds \" and \" Table 11 Start-Up 
+// Sequence \" settling times, alongside the sensitivity, of each mode.
+struct ModeProfile_t
+{
+    ScaleFactors_t m_ScaleFactors;
+    int16_t        m_STOThreshold;    // ± LSB
+    MilliSecs_t    m_SettlingTime;
+};
+
+constexpr std::array<ModeProfile_t, 4> MODE_PROFILES{{
+    {Conversions::GetScaleFactors(OperationMode_t::MODE_1), 1800, MilliSecs_t{25}},
+    {Conversions::GetScaleFactors(OperationMode_t::MODE_2),  900, MilliSecs_t{15}},
+    {Conversions::GetScaleFactors(OperationMode_t::MODE_3), 3600, MilliSecs_t{100}},
+    {Conversions::GetScaleFactors(OperationMode_t::MODE_4), 3600, MilliSecs_t{100}}}};
+
+// \" Table 11 Start-Up Sequence
+//
+// 1.2 Wait 1 ms. Memory reading. Settling of signal path. Only needed
+// after power down mode.
+// ...
+// 3 Wait 1 ms. Memory reading. Settling of signal path. \"
+constexpr MilliSecs_t WAKEUP_SETTLING_TIME{1};
+constexpr MilliSecs_t RESET_SETTLING_TIME{1};
+
+// Each poll is a single READ_STATUS_SUMMARY frame. Both ThisThread and
+// EventQueue resolve milliseconds; hence, at most ~1 ms is lost to the
+// polling granularity versus the sensor actually settling.
+constexpr MilliSecs_t READINESS_POLL_INTERVAL{1};
+
+// Operation mode policies. Most deployments never change mode; fixing it
+// at compile time folds every mode-dependent constant (scale factors, 
+// STO thresholds, settling time) and drops the dead branches. Otherwise,
+// the mode may be switched at runtime and those constants are looked up
+// upon each mode change.
+struct SwitchableMode_t
+{
+    static constexpr bool IS_FIXED = false;
+};
+
+template <OperationMode_t Mode>
+struct FixedMode_t
+{
+    static constexpr bool            IS_FIXED = true;
+    static constexpr OperationMode_t MODE     = Mode;
+};
+
+template <typename M>
+concept ModePolicy = requires
+{
+    { M::IS_FIXED } -> std::convertible_to<bool>;
+};
+
+template <ModePolicy M, OperationMode_t Mode>
+consteval bool IsModeChangeAllowed()
+{
+    if constexpr (M::IS_FIXED)
+    {
+        return (M::MODE == Mode);
+    }
+    else
+    {
+        return true;
+    }
+}
+
+// The SPI bus is a compile-time policy. By default this is mbed::SPI,
+// though any type modelling the SPITransport concept will do; e.g. the
+// in-memory transport of 'SPITransport.h' on a developer workstation.
+template <SPITransport Transport_t = DefaultSPITransport_t, ModePolicy Mode_t = SwitchableMode_t>
 class NuerteySCL3300Device
 {        
     static constexpr uint8_t DEFAULT_BYTE_ORDER = 0;  // A value of zero indicates MSB-first.
@@ -506,9 +1136,21 @@ class NuerteySCL3300Device
     // ...
     // TLH    Time between SPI cycles, CSB at high level (90%)    10   us  \"    
     static constexpr uint8_t  MINIMUM_TIME_BETWEEN_SPI_CYCLES_MICROSECS = 10;
+
+    static constexpr auto NUMBER_OF_SENSOR_DATA_READS = NUMBER_OF_CHANNELS;
     
 public:
+    using Transport_type = Transport_t;
+    using Mode_type      = Mode_t;
+
+#if defined(__MBED__)
     // \" 3-wire SPI connection is not supported. \"
+    //
+    // Chip select is driven as a GPIO (mbed::use_gpio_ssel); hence any
+    // number of devices may be constructed on the same mosi, miso and 
+    // sclk, each with its own ssel. Their SPI objects then share the one
+    // peripheral, Mbed reapplying each owner's format and frequency as
+    // the bus changes hands. See Acquisition::BusScheduler.
     NuerteySCL3300Device(
         PinName mosi,
         PinName miso,
@@ -518,22 +1160,138 @@ public:
         const uint8_t& byteOrder = DEFAULT_BYTE_ORDER,
         const uint8_t& bitsPerWord = NUMBER_OF_BITS,
         const uint32_t& frequency = DEFAULT_FREQUENCY);
+#endif
+
+    // Constructs the transport in place from 'transportArgs'.
+    template <typename... Args>
+    NuerteySCL3300Device(
+        std::in_place_t,
+        const uint8_t& mode,
+        const uint8_t& byteOrder,
+        const uint8_t& bitsPerWord,
+        const uint32_t& frequency,
+        Args&&... transportArgs);
 
     NuerteySCL3300Device(const NuerteySCL3300Device&) = delete;
     NuerteySCL3300Device& operator=(const NuerteySCL3300Device&) = delete;
 
     virtual ~NuerteySCL3300Device();
 
+    // Blocks the calling thread throughout the waits of the start-up
+    // sequence. See SensorStateMachine.h for an event-driven equivalent.
+    // Either honours the start-up policy.
     void LaunchStartupSequence();
     void LaunchNormalOperationSequence();
+
+    // \" 4 Set Measurement mode. \" along with enabling angle outputs; 
+    // i.e. the start-up step following software reset.
+    std::error_code SetMeasurementMode();
+
+    void SetStartupPolicy(const StartupPolicy_t& policy) { m_StartupPolicy = policy; }
+    StartupPolicy_t GetStartupPolicy() const { return m_StartupPolicy; }
+
+    // One readiness poll; i.e. a single READ_STATUS_SUMMARY frame whose
+    // response's RS bits are examined. Returns success, and concludes the
+    // start-up, once they read '01'. Until then, returns 
+    // ERROR_RETURN_STATUS_STARTUP_IN_PROGRESS.
+    std::error_code PollStartupReadiness();
+
+    // The datasheet conclusion of the start-up sequence, once the full 
+    // settling time has elapsed; i.e. clearing STATUS.
+    std::error_code ConcludeStartupSettling();
+
+    const StartupStatistics_t& GetStartupStatistics() const { return m_StartupStatistics; }
+    void PrintStartupStatistics() const;
     
     std::error_code LaunchSelfTestMonitoring();
 
-    void ReadSensorData(auto& item);
+    void ReadSensorData(const Channel_t& channel);
     void ReadAllSensorData();
 
+    // Off-frame pipelined burst reads. N registers are read in N+1 SPI
+    // frames plus whatever SELBANK frames are needed in between.
+    // Optionally, the RS bits of each read's response are recorded into
+    // 'returnStatuses'.
+    std::error_code ReadRegistersPipelined(std::span<const RegisterRead_t> reads,
+                                           std::span<uint16_t> values,
+                                           std::span<uint8_t> returnStatuses = {});
+    std::error_code ExecuteFrameTrain(const FrameTrain_t& train,
+                                      std::span<const RegisterRead_t> reads,
+                                      std::span<uint16_t> values,
+                                      std::span<uint8_t> returnStatuses = {});
+    std::error_code ReadAllSensorDataPipelined();
+
+    // Transfers the cursor's next frame, validating the previous frame's
+    // response during the inter-frame gap, and the final response right
+    // away. Busy-waits for whatever remains of this device's gap.
+    std::error_code TransferNextFrame(FrameTrainCursor_t& cursor);
+
+    // ReadChannelsPipelined(), in three steps: begin composes the sweep's
+    // frame train, TransferNextFrame(sweep.m_Cursor) is then called until
+    // the cursor is complete, and conclude updates the latest sample.
+    std::error_code BeginChannelSweep(ChannelSweep_t& sweep, const ChannelSet_t& channels);
+    std::error_code ConcludeChannelSweep(ChannelSweep_t& sweep);
+
+    // Reads only the selected channels, in one pipelined burst, into the
+    // latest sample. Unselected channels retain their previous readings.
+    // Errors are returned rather than printed, as this is the hot path
+    // of the sampling engine.
+    std::error_code ReadChannelsPipelined(const ChannelSet_t& channels);
+
+    // As above, but with the channel subset fixed at compile time; e.g.
+    // ReadChannels<Channel_t::ANGLE_X_AXIS, Channel_t::ANGLE_Y_AXIS,
+    // Channel_t::ANGLE_Z_AXIS>() reads the three angles in four frames.
+    // The frame train and its response decoding are precomputed.
+    template <Channel_t... Channels>
+        requires ValidChannelList<Channels...>
+    std::error_code ReadChannels();
+
+    template <Channel_t... Channels>
+        requires ValidChannelList<Channels...>
+    std::error_code ReadChannels(ChannelList_t<Channels...>) { return ReadChannels<Channels...>(); }
+
+    // Streaming single-channel reads for control loops. Successive calls
+    // for the same channel transmit the very same read frame, and so, by
+    // virtue of the off-frame protocol, each single frame returns a new
+    // value. That is, the answer to the previous call's request. Only the
+    // first call, or any call following other SPI traffic, must first 
+    // prime the pipeline (and select bank #0). No printf() is incurred.
+    template <Channel_t Channel>
+        requires (Channel < Channel_t::NUMBER_OF_CHANNELS)
+    std::error_code StreamChannel(int16_t& value);
+
+    const StreamStatistics_t& GetStreamStatistics() const { return m_StreamStatistics; }
+    void ResetStreamStatistics() { m_StreamStatistics = StreamStatistics_t{}; }
+    void PrintStreamStatistics() const;
+
+    // Hot paths defer their diagnostics to this log rather than printf()
+    // them. Drain it from a low-priority thread via PrintEventLog(), or
+    // hand the raw events to a host tool via GetEventLog().Drain().
+    Diagnostics::EventLog<>& GetEventLog() { return m_EventLog; }
+    std::size_t PrintEventLog(const std::size_t& maximum = Diagnostics::DEFAULT_EVENT_LOG_CAPACITY);
+
+#if DEVICE_SPI_ASYNCH
+    // Non-blocking, DMA-backed counterparts. These return as soon as the
+    // frame train has been queued. Each frame is validated as it completes
+    // and 'onComplete' is eventually invoked, in interrupt context, with 
+    // the first error encountered (if any). The 'reads' and 'values' spans
+    // must outlive the transfer.
+    using TransferCompletion_t = mbed::Callback<void(std::error_code)>;
+
+    std::error_code StartFrameTrainAsync(const FrameTrain_t& train,
+                                         std::span<const RegisterRead_t> reads,
+                                         std::span<uint16_t> values,
+                                         TransferCompletion_t onComplete,
+                                         std::span<uint8_t> returnStatuses = {});
+    std::error_code ReadAllSensorDataAsync(TransferCompletion_t onComplete);
+
+    bool IsAsyncTransferInProgress() const { return m_AsyncTransferInProgress; }
+#endif
+
     std::error_code ClearStatusSummaryRegister();
 
+    // Also called in interrupt context by OnAsyncFrameComplete(); hence
+    // it must never print, but only record into the event log.
     template <typename T>
     std::error_code ValidateSPIResponseFrame(T& sensorData,
                                 const SPICommandFrame_t& commandFrame,
@@ -543,8 +1301,25 @@ public:
     
     std::error_code FullDuplexTransfer(const SPICommandFrame_t& cBuffer, 
                                              SPICommandFrame_t& rBuffer);
+
+    // As above, but performs 'gapWork' (e.g. validating the previous 
+    // response) whilst the inter-frame gap elapses, only busy-waiting
+    // for whatever remains of the gap thereafter.
+    template <typename F>
+    std::error_code FullDuplexTransfer(const SPICommandFrame_t& cBuffer, 
+                                             SPICommandFrame_t& rBuffer,
+                                             F&& gapWork);
+
+    MicroSecs_t RemainingInterFrameGap() const;
+
+    // Transmits the SELBANK frame only if the shadowed active memory bank
+    // differs from the one requested.
+    std::error_code SelectBank(const SPICommandFrame_t& bankFrame,
+                                     SPICommandFrame_t& rBuffer);
     
-    // Gets work on already retrieved SCL3300SensorData_t.
+    // Gets work on already retrieved SCL3300Sample_t.
+    SCL3300Sample_t GetLatestSample() const { return m_LatestSample; }
+
     double GetAccelerationXAxis() const;
     double GetAccelerationYAxis() const;
     double GetAccelerationZAxis() const;
@@ -554,21 +1329,48 @@ public:
     
     template<typename T>
     double GetTemperature() const;
+
+    // Integer counterparts of the above. The acceleration scale factor
+    // is selected upon each mode change rather than upon each sample.
+    FixedPointSample_t ConvertToFixedPoint(const SCL3300Sample_t& sample) const;
+    FixedPointSample_t GetLatestFixedPointSample() const { return ConvertToFixedPoint(m_LatestSample); }
+
+    const ScaleFactors_t& GetScaleFactors() const { return GetModeProfile().m_ScaleFactors; }
+
+    // Folds to a constant under FixedMode_t.
+    constexpr const ModeProfile_t& GetModeProfile() const
+    {
+        if constexpr (Mode_t::IS_FIXED)
+        {
+            return MODE_PROFILES[ToUnderlyingType(Mode_t::MODE)];
+        }
+        else
+        {
+            return *m_ModeProfile;
+        }
+    }
     
     std::error_code GetSelfTestOutputErrorCode() const;
     std::error_code GetStatusSummaryErrorCode() const;
 
+    // Every flag of the most recently read STATUS, rather than only the
+    // one reported by GetStatusSummaryErrorCode().
+    StatusFlagSet_t GetStatusSummaryFlags() const;
+
     // C++20 concepts:    
     template <typename E>
         requires (std::is_same_v<E, ErrorFlag1Reason_t> || std::is_same_v<E, ErrorFlag2Reason_t>)
-    void PrintErrorFlagReason(const uint16_t& errorFlag, const E& reason) const;
+    void PrintErrorFlagReasons(const uint16_t& errorFlag, const FlagSet_t<E>& reasons) const;
 
     // Reads employ SPI to actually retrieve fresh data from the device.    
-    std::error_code ReadErrorFlag1Reason(uint16_t& errorFlag,
-                                         ErrorFlag1Reason_t& reason);
-    std::error_code ReadErrorFlag2Reason(uint16_t& errorFlag, 
-                                         ErrorFlag2Reason_t& reason);
+    std::error_code ReadErrorFlag1Reasons(uint16_t& errorFlag,
+                                          ErrorFlag1Set_t& reasons);
+    std::error_code ReadErrorFlag2Reasons(uint16_t& errorFlag, 
+                                          ErrorFlag2Set_t& reasons);
+    std::error_code ReadSerialNumber(SerialNumber_t& serialNumber);
+#if !defined(SCL3300_ZERO_HEAP)
     std::error_code ReadSerialNumber(std::string& serialNumber);
+#endif
     std::error_code ReadCurrentBank(MemoryBank_t& bank);
     
     void PrintCommandRegisterValues(const uint16_t& commandValue) const;
@@ -586,15 +1388,18 @@ public:
     std::error_code EnableAngleOutputs();
     
     void InitiateResetIfErrorCode(const std::error_code& errorCode);
-    void InitiateResetIfErrorFlag2(const ErrorFlag2Reason_t& reason);
+    void InitiateResetIfErrorFlag2(const ErrorFlag2Set_t& reasons);
     
-    void ChangeToMode1();
-    void ChangeToMode2();
-    void ChangeToMode3();
-    void ChangeToMode4();
+    // A fixed-mode device may only be (re)set to its own mode.
+    std::error_code ChangeToMode1() requires (IsModeChangeAllowed<Mode_t, OperationMode_t::MODE_1>());
+    std::error_code ChangeToMode2() requires (IsModeChangeAllowed<Mode_t, OperationMode_t::MODE_2>());
+    std::error_code ChangeToMode3() requires (IsModeChangeAllowed<Mode_t, OperationMode_t::MODE_3>());
+    std::error_code ChangeToMode4() requires (IsModeChangeAllowed<Mode_t, OperationMode_t::MODE_4>());
     void PowerDown();
     void WakeupFromPowerDown();
     void SoftwareReset();
+
+    bool IsPoweredDown() const { return m_PoweredDownMode; }
     
     void AssertWhoAmI() const;
     
@@ -603,8 +1408,22 @@ public:
     uint8_t  GetBitsPerWord() const { return m_BitsPerWord; }
     uint32_t GetFrequency() const { return m_Frequency; };
 
-protected:
-    double ConvertAcceleration(const int16_t& accelaration) const;
+    OperationMode_t GetInclinometerMode() const { return m_InclinometerMode; }
+
+    Transport_t&       GetTransport() { return m_TheSPIBus; }
+    const Transport_t& GetTransport() const { return m_TheSPIBus; }
+
+    // Shadow of the sensor's active memory bank. Empty whilst unknown,
+    // e.g. prior to the first SELBANK frame or software reset.
+    std::optional<MemoryBank_t> GetActiveBank() const { return m_ActiveBank; }
+    uint32_t GetBankSwitchesAvoided() const { return m_BankSwitchesAvoided; }
+
+    // Every frame clocked out, blocking or DMA-backed; i.e. each worth
+    // NUMBER_OF_SPI_COMMAND_FRAME_BYTES in either direction. Wraps.
+    uint32_t GetSPIFrameCount() const { return m_SPIFrameCount; }
+
+protected:
+    double ConvertAcceleration(const int16_t& accelaration) const;
     double ConvertAngle(const int16_t& angle) const;
     double ConvertTemperature(const int16_t& temperature) const;    
     
@@ -614,24 +1433,117 @@ protected:
     std::error_code ConvertStatusSummaryToErrorCode(const uint16_t& status) const;
     std::error_code ConvertSTOToErrorCode(const int16_t& sto) const;
     
-    ErrorFlag1Reason_t ConvertErrorFlag1ToReason(const uint16_t& errorFlag) const;
-    ErrorFlag2Reason_t ConvertErrorFlag2ToReason(const uint16_t& errorFlag) const;
-    
-    std::string ComposeSerialNumber(const uint16_t& serial1LSB, 
-                                    const uint16_t& serial2MSB) const;
+    void ComposeSerialNumber(const uint16_t& serial1LSB, 
+                             const uint16_t& serial2MSB,
+                             SerialNumber_t& serialNumber) const;
+
+    // Tracks the sensor's operation mode along with its mode profile.
+    void SetInclinometerMode(const OperationMode_t& mode);
+
+    std::error_code ChangeToFixedMode() requires (Mode_t::IS_FIXED);
+
+    bool IsBankActive(const SPICommandFrame_t& bankFrame) const;
+    // Shadows the active memory bank and the last command frame to have
+    // gone out intact.
+    void TrackSensorState(const SPICommandFrame_t& cBuffer, const std::error_code& result);
+
+    // Both return the number of selected channels.
+    std::size_t GatherSensorDataReads(const ChannelSet_t& channels,
+                                      std::span<RegisterRead_t> reads,
+                                      std::span<uint16_t> values) const;
+    std::size_t ScatterSensorDataValues(const ChannelSet_t& channels,
+                                        std::span<const uint16_t> values,
+                                        std::span<const uint8_t> returnStatuses,
+                                        const MonotonicClock_t::time_point& timestamp);
+
+#if DEVICE_SPI_ASYNCH
+    // As StartFrameTrainAsync(), save that the caller must already have
+    // claimed m_AsyncTransferInProgress.
+    std::error_code LaunchFrameTrainAsync(const FrameTrain_t& train,
+                                          std::span<const RegisterRead_t> reads,
+                                          std::span<uint16_t> values,
+                                          TransferCompletion_t onComplete,
+                                          std::span<uint8_t> returnStatuses);
+    void TransferNextAsyncFrame();
+    void OnAsyncFrameComplete(int event);
+    void CompleteAsyncTransfer(const std::error_code& result);
+    void OnAsyncSweepComplete(std::error_code result);
+#endif
+
+    // Start-up latency bookkeeping. The first of wake-up and software
+    // reset begins a start-up; readiness concludes it.
+    void BeginStartupTiming();
+    void ConcludeStartupTiming(const bool& pollingTimedOut);
+    void RecordFirstSample()
+    {
+        if (m_AwaitingFirstSample) [[unlikely]]
+        {
+            m_AwaitingFirstSample = false;
+            m_StartupStatistics.m_FirstSampleLatency = 
+                std::chrono::duration_cast<MicroSecs_t>(MonotonicClock_t::now() - m_StartupTime);
+        }
+    }
     
 private:               
-    SPI                                m_TheSPIBus;
+    Transport_t                        m_TheSPIBus;
     uint8_t                            m_Mode;
     uint8_t                            m_ByteOrder;
     uint8_t                            m_BitsPerWord;
     uint32_t                           m_Frequency;
     OperationMode_t                    m_InclinometerMode;
+    const ModeProfile_t*               m_ModeProfile;
+
+    // Latest sensor data; one per device, so that several may share a
+    // bus. We must ensure to populate all of its channels each time we
+    // read a set of sensor data.
+    SCL3300Sample_t                    m_LatestSample;
+
     bool                               m_PoweredDownMode;
-    NucleoF767ZIClock_t::time_point    m_LastSPITransferTime;
+    bool                               m_StartupIndicated;
+    MonotonicClock_t::time_point       m_LastSPITransferTime;
+    std::optional<MemoryBank_t>        m_ActiveBank;
+    SPICommandFrame_t                  m_LastCommandFrame;
+    StreamStatistics_t                 m_StreamStatistics;
+    Diagnostics::EventLog<>            m_EventLog;
+    uint32_t                           m_ReportedDroppedEvents;
+    uint32_t                           m_BankSwitchesAvoided;
+    std::atomic<uint32_t>              m_SPIFrameCount;
+    StartupPolicy_t                    m_StartupPolicy;
+    StartupStatistics_t                m_StartupStatistics;
+    MonotonicClock_t::time_point       m_StartupTime;
+    bool                               m_StartupInProgress;
+    bool                               m_AwaitingFirstSample;
+
+#if DEVICE_SPI_ASYNCH
+    // Asynchronous transfer state. Note that the receive buffer of a DMA
+    // transfer must be cache-aligned on the Cortex-M7.
+    FrameTrain_t                                       m_AsyncTrain;
+    std::span<const RegisterRead_t>                    m_AsyncReads;
+    std::span<uint16_t>                                m_AsyncValues;
+    std::span<uint8_t>                                 m_AsyncReturnStatuses;
+    std::size_t                                        m_AsyncFrameIndex;
+    std::error_code                                    m_AsyncResult;
+    TransferCompletion_t                               m_AsyncCompletion;
+    StaticCacheAlignedBuffer<uint8_t, NUMBER_OF_SPI_COMMAND_FRAME_BYTES> m_AsyncResponse;
+    Timeout                                            m_InterFrameTimeout;
+    std::atomic<bool>                                  m_AsyncTransferInProgress;
+
+    std::array<RegisterRead_t, NUMBER_OF_SENSOR_DATA_READS> m_SweepReads;
+    std::array<uint16_t, NUMBER_OF_SENSOR_DATA_READS>       m_SweepValues;
+    std::array<uint8_t, NUMBER_OF_SENSOR_DATA_READS>        m_SweepReturnStatuses;
+    MonotonicClock_t::time_point                            m_SweepTimestamp;
+    TransferCompletion_t                                    m_SweepCompletion;
+#endif
 };
 
-NuerteySCL3300Device::NuerteySCL3300Device(PinName mosi,
+// E.g. FixedModeSCL3300Device<OperationMode_t::MODE_4> for an inclinometer
+// which is only ever operated in Mode 4.
+template <OperationMode_t Mode, SPITransport Transport_t = DefaultSPITransport_t>
+using FixedModeSCL3300Device = NuerteySCL3300Device<Transport_t, FixedMode_t<Mode>>;
+
+#if defined(__MBED__)
+template <SPITransport Transport_t, ModePolicy Mode_t>
+NuerteySCL3300Device<Transport_t, Mode_t>::NuerteySCL3300Device(PinName mosi,
                                            PinName miso,
                                            PinName sclk,
                                            PinName ssel,
@@ -646,14 +1558,60 @@ NuerteySCL3300Device::NuerteySCL3300Device(PinName mosi,
     // the SSEL pin as a GPIO output using a DigitalOut object. This 
     // should work on any target, and permits the use of select() and 
     // deselect() methods to keep the pin asserted between transfers.
-    : m_TheSPIBus(mosi, miso, sclk, ssel, mbed::use_gpio_ssel)
+    : NuerteySCL3300Device(std::in_place, mode, byteOrder, bitsPerWord, frequency,
+                           mosi, miso, sclk, ssel, mbed::use_gpio_ssel)
+{
+}
+#endif
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+template <typename... Args>
+NuerteySCL3300Device<Transport_t, Mode_t>::NuerteySCL3300Device(std::in_place_t,
+                                           const uint8_t& mode,
+                                           const uint8_t& byteOrder,
+                                           const uint8_t& bitsPerWord,
+                                           const uint32_t& frequency,
+                                           Args&&... transportArgs)
+    : m_TheSPIBus(std::forward<Args>(transportArgs)...)
     , m_Mode(mode)
     , m_ByteOrder(byteOrder)
     , m_BitsPerWord(bitsPerWord)
     , m_Frequency(frequency)
     , m_InclinometerMode(OperationMode_t::MODE_1) // \" (default) 1.8g full-scale 40 Hz 1st order low pass filter \"
+    , m_ModeProfile(&MODE_PROFILES[ToUnderlyingType(OperationMode_t::MODE_1)])
+    , m_LatestSample()
     , m_PoweredDownMode(false)
-    , m_LastSPITransferTime(NucleoF767ZIClock_t::now()) // Just a placeholder for construction/initialization.
+    , m_StartupIndicated(false)
+    , m_LastSPITransferTime() // The epoch; i.e. no gap is owed before the very first frame.
+    , m_ActiveBank()  // Unknown until the first SELBANK frame or reset.
+    , m_LastCommandFrame()
+    , m_StreamStatistics()
+    , m_EventLog()
+    , m_ReportedDroppedEvents(0)
+    , m_BankSwitchesAvoided(0)
+    , m_SPIFrameCount(0)
+    , m_StartupPolicy(StartupPolicy_t::DATASHEET_SETTLING)
+    , m_StartupStatistics()
+    , m_StartupTime()
+    , m_StartupInProgress(false)
+    , m_AwaitingFirstSample(false)
+#if DEVICE_SPI_ASYNCH
+    , m_AsyncTrain()
+    , m_AsyncReads()
+    , m_AsyncValues()
+    , m_AsyncReturnStatuses()
+    , m_AsyncFrameIndex(0)
+    , m_AsyncResult()
+    , m_AsyncCompletion()
+    , m_AsyncResponse()
+    , m_InterFrameTimeout()
+    , m_AsyncTransferInProgress(false)
+    , m_SweepReads()
+    , m_SweepValues()
+    , m_SweepReturnStatuses()
+    , m_SweepTimestamp()
+    , m_SweepCompletion()
+#endif
 {
     // \" The SPI transmission is always started with the falling edge of 
     // chip select, CSB. The data bits are sampled at the rising edge of
@@ -687,13 +1645,24 @@ NuerteySCL3300Device::NuerteySCL3300Device(PinName mosi,
     // void frequency(int hz = 1000000);
     m_TheSPIBus.format(m_BitsPerWord, m_Mode);
     m_TheSPIBus.frequency(m_Frequency);
+
+#if DEVICE_SPI_ASYNCH
+    // Have asynchronous transfers be serviced by DMA rather than by
+    // per-byte interrupts, where the transport is DMA-capable at all.
+    if constexpr (requires { m_TheSPIBus.set_dma_usage(DMA_USAGE_ALWAYS); })
+    {
+        m_TheSPIBus.set_dma_usage(DMA_USAGE_ALWAYS);
+    }
+#endif
 }
 
-NuerteySCL3300Device::~NuerteySCL3300Device()
+template <SPITransport Transport_t, ModePolicy Mode_t>
+NuerteySCL3300Device<Transport_t, Mode_t>::~NuerteySCL3300Device()
 {
 }
 
-void NuerteySCL3300Device::LaunchStartupSequence()
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::LaunchStartupSequence()
 {
     std::error_code result{};
     
@@ -709,7 +1678,7 @@ void NuerteySCL3300Device::LaunchStartupSequence()
         //
         // Memory reading. Settling of signal path. Only needed after
         // power down mode. \"
-        ThisThread::sleep_for(1ms);
+        ThisThread::sleep_for(WAKEUP_SETTLING_TIME);
     }
     
     // \" 2 Write SW Reset command. Software reset the device \"
@@ -718,71 +1687,223 @@ void NuerteySCL3300Device::LaunchStartupSequence()
     // \" 3 Wait 1 ms. 
     //
     // Memory reading. Settling of signal path. \"
-    ThisThread::sleep_for(1ms);
+    ThisThread::sleep_for(RESET_SETTLING_TIME);
+    
+    result = SetMeasurementMode();
+    if (result)
+    {
+        printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
+                  result.value(), GetErrorMessage(result));
+        
+        // Leave the sensor in a known (default) mode; start-up is to be
+        // relaunched by the caller.
+        SoftwareReset();
+        return;
+    }
     
+    // \" Settling of signal path. \" Mode 1: 25 ms, Mode 2: 15 ms, 
+    // Modes 3 and 4: 100 ms. These being worst cases, the sensor may
+    // well be polled for readiness ahead of them.
+    const auto settlingTime = GetModeProfile().m_SettlingTime;
+
+    if (m_StartupPolicy == StartupPolicy_t::READINESS_POLLING)
+    {
+        const auto deadline = MonotonicClock_t::now() + settlingTime;
+
+        while ((MonotonicClock_t::now() + READINESS_POLL_INTERVAL) < deadline)
+        {
+            ThisThread::sleep_for(READINESS_POLL_INTERVAL);
+
+            if (!PollStartupReadiness())
+            {
+                return;
+            }
+        }
+
+        // Fall back to the datasheet; sleep out whatever remains of it.
+        const auto remaining = std::chrono::ceil<MilliSecs_t>(deadline - MonotonicClock_t::now());
+        if (remaining > MilliSecs_t(0))
+        {
+            ThisThread::sleep_for(remaining);
+        }
+    }
+    else
+    {
+        ThisThread::sleep_for(settlingTime);
+    }
+
+    result = ConcludeStartupSettling();
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::SetMeasurementMode()
+{
     // \" 4 Set Measurement mode. Select operation mode. if not set, 
     // mode1 is used. \"
-    ChangeToMode4(); // For illustration purposes. TBD, User should change as desired.   
+    std::error_code result{};
     
-    result = EnableAngleOutputs();
+    if constexpr (Mode_t::IS_FIXED)
+    {
+        result = ChangeToFixedMode();
+    }
+    else
+    {
+        result = ChangeToMode4(); // For illustration purposes. TBD, User should change as desired.   
+    }
     
-    if (OperationMode_t::MODE_1 == m_InclinometerMode)
-    { 
-        // \" Settling of signal path. \"
-        ThisThread::sleep_for(25ms);
+    // A failed mode change is the caller's to recover from; i.e. by way
+    // of a software reset, which also reverts the sensor to Mode 1.
+    if (!result)
+    {
+        result = EnableAngleOutputs();
     }
-    else if (OperationMode_t::MODE_2 == m_InclinometerMode)
+    
+    return result;
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::PollStartupReadiness()
+{
+    // Safety check.
+    AssertValidSPICommandFrame<READ_STATUS_SUMMARY>();
+
+    // \" SPI frame Return Status bits (RS bits) indicates the functional
+    // status of the sensor. \" They accompany every response, and so the
+    // off-frame response to whichever frame went before will do. Bank #0
+    // is active; software reset selected it and mode selection writes
+    // nothing but bank #0 registers.
+    //
+    // \" Read STATUS. '11' Clear status summary. Reset status summary \"
+    // That is, whilst settled yet flagged (e.g. by the mode change), this
+    // very frame clears STATUS, and the next poll reads '01'.
+    SPICommandFrame_t response = {}; // Initialize to zeros.
+
+    ++m_StartupStatistics.m_ReadinessPolls;
+
+    auto result = FullDuplexTransfer(READ_STATUS_SUMMARY, response);
+    if (!result)
     {
-        // \" Settling of signal path. \"
-        ThisThread::sleep_for(15ms);
+        result = ValidateCRC(response);
+        if (!result)
+        {
+            if (GetReturnStatus(response) == ToUnderlyingType(ReturnStatus_t::NORMAL_OPERATION_NO_FLAGS))
+            {
+                ConcludeStartupTiming(false);
+            }
+            else
+            {
+                result = make_error_code(SensorStatus_t::ERROR_RETURN_STATUS_STARTUP_IN_PROGRESS);
+            }
+        }
     }
-    else if ((OperationMode_t::MODE_3 == m_InclinometerMode)
-          || (OperationMode_t::MODE_4 == m_InclinometerMode))
+
+    return result;
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ConcludeStartupSettling()
+{
+    // \" Read STATUS. Clear status summary. \"
+    const auto result = ClearStatusSummaryRegister();
+    if (!result)
     {
-        // \" Settling of signal path. \"
-        ThisThread::sleep_for(100ms);
+        ConcludeStartupTiming(m_StartupPolicy == StartupPolicy_t::READINESS_POLLING);
     }
 
-    result = ClearStatusSummaryRegister();
+    return result;
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::BeginStartupTiming()
+{
+    if (!m_StartupInProgress)
+    {
+        m_StartupInProgress   = true;
+        m_AwaitingFirstSample = false;
+        m_StartupTime         = MonotonicClock_t::now();
+        m_StartupStatistics   = StartupStatistics_t{m_StartupPolicy};
+    }
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::ConcludeStartupTiming(const bool& pollingTimedOut)
+{
+    if (m_StartupInProgress)
+    {
+        m_StartupInProgress   = false;
+        m_AwaitingFirstSample = true;
+
+        m_StartupStatistics.m_PollingTimedOut = pollingTimedOut;
+        m_StartupStatistics.m_ReadyLatency    = 
+            std::chrono::duration_cast<MicroSecs_t>(MonotonicClock_t::now() - m_StartupTime);
+    }
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::PrintStartupStatistics() const
+{
+    const auto& statistics = m_StartupStatistics;
+
+    printf("\nStart-up Statistics:\n");
+    printf("\tPolicy                  := [%s]\n",
+        (statistics.m_Policy == StartupPolicy_t::READINESS_POLLING) ? "Readiness polling" 
+                                                                    : "Datasheet settling");
+
+    if (statistics.m_Policy == StartupPolicy_t::READINESS_POLLING)
+    {
+        printf("\tReadiness Polls         := [%lu]%s\n", 
+            static_cast<unsigned long>(statistics.m_ReadinessPolls),
+            statistics.m_PollingTimedOut ? " (timed out)" : "");
+    }
+
+    printf("\tReady Latency           := [%lld us]\n",
+        static_cast<long long>(statistics.m_ReadyLatency.count()));
+    printf("\tFirst Sample Latency    := [%lld us]\n",
+        static_cast<long long>(statistics.m_FirstSampleLatency.count()));
 }
 
 // The intent of this method is to illustrate how to use this driver in
 // querying information from the Murata SCL3300 Inclinometer sensor.    
-void NuerteySCL3300Device::LaunchNormalOperationSequence()
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::LaunchNormalOperationSequence()
 {
     std::error_code result{};
     
     // Reads employ SPI to actually retrieve fresh data from the device. 
-    ReadAllSensorData();    
+    ReadAllSensorDataPipelined();
+
+    // Gets() work on already retrieved instance of SCL3300Sample_t. 
+    // One buffer suffices as each value is printed before the next is 
+    // formatted.
+    Formatting::TextBuffer_t<> buffer;
 
-    // Gets() work on already retrieved instance of SCL3300SensorData_t.
     printf("\tGetAccelerationXAxis() = %s g. Gravitational Acceleration Constant, g = 9.819 m/s2\n",
-        TruncateAndToString<double>(GetAccelerationXAxis()).c_str());
+        Formatting::FormatFixed(buffer, GetAccelerationXAxis()).data());
     printf("\tGetAccelerationYAxis() = %s g. Gravitational Acceleration Constant, g = 9.819 m/s2\n", 
-        TruncateAndToString<double>(GetAccelerationYAxis()).c_str());
+        Formatting::FormatFixed(buffer, GetAccelerationYAxis()).data());
     printf("\tGetAccelerationZAxis() = %s g. Gravitational Acceleration Constant, g = 9.819 m/s2\n", 
-        TruncateAndToString<double>(GetAccelerationZAxis()).c_str());
+        Formatting::FormatFixed(buffer, GetAccelerationZAxis()).data());
 
-    printf("\tGetAngleXAxis = %s°\n", TruncateAndToString<double>(GetAngleXAxis()).c_str());
-    printf("\tGetAngleYAxis = %s°\n", TruncateAndToString<double>(GetAngleYAxis()).c_str());
-    printf("\tGetAngleZAxis = %s°\n", TruncateAndToString<double>(GetAngleZAxis()).c_str());
+    printf("\tGetAngleXAxis = %s°\n", Formatting::FormatFixed(buffer, GetAngleXAxis()).data());
+    printf("\tGetAngleYAxis = %s°\n", Formatting::FormatFixed(buffer, GetAngleYAxis()).data());
+    printf("\tGetAngleZAxis = %s°\n", Formatting::FormatFixed(buffer, GetAngleZAxis()).data());
     
-    printf("\tGetTemperature<Celsius_t>() = %s °C\n", TruncateAndToString<double>(GetTemperature<Celsius_t>()).c_str());
-    printf("\tGetTemperature<Fahrenheit_t>() = %s °F\n", TruncateAndToString<double>(GetTemperature<Fahrenheit_t>()).c_str());
-    printf("\tGetTemperature<Kelvin_t>() = %s K\n",  TruncateAndToString<double>(GetTemperature<Kelvin_t>()).c_str());
+    printf("\tGetTemperature<Celsius_t>() = %s °C\n", Formatting::FormatFixed(buffer, GetTemperature<Celsius_t>()).data());
+    printf("\tGetTemperature<Fahrenheit_t>() = %s °F\n", Formatting::FormatFixed(buffer, GetTemperature<Fahrenheit_t>()).data());
+    printf("\tGetTemperature<Kelvin_t>() = %s K\n",  Formatting::FormatFixed(buffer, GetTemperature<Kelvin_t>()).data());
     
     result = GetSelfTestOutputErrorCode();
     if (result) // We only care if there is indeed an error.
     {
         printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                  result.value(), result.message().c_str());
+                  result.value(), GetErrorMessage(result));
     }
     
     result = GetStatusSummaryErrorCode();
     if (result) // We only care if there is indeed an error.
     {
         printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                  result.value(), result.message().c_str());
+                  result.value(), GetErrorMessage(result));
                   
         InitiateResetIfErrorCode(result);
     }
@@ -792,16 +1913,16 @@ void NuerteySCL3300Device::LaunchNormalOperationSequence()
     // register.
     AssertWhoAmI();
     
-    std::string mySerialNumber;
+    SerialNumber_t mySerialNumber{};
     result = ReadSerialNumber(mySerialNumber);
     if (!result)
     {
-        printf("SCL3300 Device Serial Number = %s\n", mySerialNumber.c_str());
+        printf("SCL3300 Device Serial Number = %s\n", mySerialNumber.data());
     }
     else
     {
         printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                  result.value(), result.message().c_str());
+                  result.value(), GetErrorMessage(result));
     }
     
     MemoryBank_t currentMemoryBank;
@@ -813,7 +1934,7 @@ void NuerteySCL3300Device::LaunchNormalOperationSequence()
     else
     {
         printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                  result.value(), result.message().c_str());
+                  result.value(), GetErrorMessage(result));
     }
     
     // Will print out command register values by itself. Similar behavior
@@ -825,33 +1946,36 @@ void NuerteySCL3300Device::LaunchNormalOperationSequence()
     if (result)
     {
         printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                  result.value(), result.message().c_str());
+                  result.value(), GetErrorMessage(result));
     }
     
     uint16_t errorFlag1 = 0; 
-    ErrorFlag1Reason_t reason1;
-    result = ReadErrorFlag1Reason(errorFlag1, reason1);
+    ErrorFlag1Set_t reasons1{};
+    result = ReadErrorFlag1Reasons(errorFlag1, reasons1);
     if (result)
     {
         printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                  result.value(), result.message().c_str());
+                  result.value(), GetErrorMessage(result));
     }
     
     uint16_t errorFlag2 = 0; 
-    ErrorFlag2Reason_t reason2;
-    result = ReadErrorFlag2Reason(errorFlag2, reason2);
+    ErrorFlag2Set_t reasons2{};
+    result = ReadErrorFlag2Reasons(errorFlag2, reasons2);
     if (result)
     {
         printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                  result.value(), result.message().c_str());
-                  
-        InitiateResetIfErrorFlag2(reason2);
+                  result.value(), GetErrorMessage(result));
+    }
+    else
+    {
+        InitiateResetIfErrorFlag2(reasons2);
     }
     
     result = ClearStatusSummaryRegister();
 }
 
-std::error_code NuerteySCL3300Device::LaunchSelfTestMonitoring()
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::LaunchSelfTestMonitoring()
 {   
     // \" Self-Test Analysis \"
     
@@ -880,19 +2004,18 @@ std::error_code NuerteySCL3300Device::LaunchSelfTestMonitoring()
     
     static const uint32_t NUMBER_OF_TEST_RUNS(3); // Change as per User's wish.
     uint32_t countOverThreshold = 0;
+    bool     printOnce = true;
     
     // Begin from 1 so that there is no possibility of us running into a
     // divide-by-zero exception.
     uint32_t count = 1; 
     for (; count <= NUMBER_OF_TEST_RUNS; count++)
     {
-        ReadAllSensorData();    
+        ReadAllSensorDataPipelined();
 
         result = GetSelfTestOutputErrorCode();
         if (result) // We only care if there is indeed an error.
         {
-            static bool printOnce = true;
-            
             ++countOverThreshold;
             if (printOnce)
             {
@@ -900,7 +2023,7 @@ std::error_code NuerteySCL3300Device::LaunchSelfTestMonitoring()
                 
                 printf("Error! %s: \n\t[%d] -> %s\n", 
                     __PRETTY_FUNCTION__,
-                    result.value(), result.message().c_str());
+                    result.value(), GetErrorMessage(result));
             }
         }
     }
@@ -913,7 +2036,7 @@ std::error_code NuerteySCL3300Device::LaunchSelfTestMonitoring()
 
         // Alert the user as soon as possible:
         printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                  result.value(), result.message().c_str());
+                  result.value(), GetErrorMessage(result));
     }
     else
     {
@@ -923,15 +2046,19 @@ std::error_code NuerteySCL3300Device::LaunchSelfTestMonitoring()
     return result;
 }
 
-template <typename T>
-void NuerteySCL3300Device::ReadSensorData(T& item)
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::ReadSensorData(const Channel_t& channel)
 {
     std::error_code result{};
     
-    // Safety check.
-    AssertValidSPICommandFrame<SPICommandFrame_t>(std::get<0>(item));
-    AssertValidSPICommandFrame<SPICommandFrame_t>(std::get<1>(item));
-    AssertValidSPICommandFrame<SPICommandFrame_t>(SWITCH_TO_BANK_0);
+    const auto& [bankFrame, commandFrame] = CHANNEL_READS[ToUnderlyingType(channel)];
+    const auto channelIndex = static_cast<int32_t>(ToUnderlyingType(channel));
+    
+    // Safety check. The frames of 'channel' are only known at runtime hence
+    // are only checked in debug builds; the rest at compile time.
+    assert(IsAllowedCommandFrame(bankFrame));
+    assert(IsAllowedCommandFrame(commandFrame));
+    AssertValidSPICommandFrame<SWITCH_TO_BANK_0>();
     
     // \" ... Due to off-frame protocol of SPI the first response to 
     // MOSI command is a response to earlier MOSI command and is thus
@@ -944,70 +2071,56 @@ void NuerteySCL3300Device::ReadSensorData(T& item)
     // recommended to keep memory bank #0 selected unless register from
     // bank #1 is required, for example, reading serial number of sensor.
     // After using bank #1 user should switch back to bank #0. \"
-    result = FullDuplexTransfer(std::get<0>(item), response);
+    result = SelectBank(bankFrame, response);
     if (!result)
     {
         // Ignore first SPI response per off-frame protocol note above.
-        result = FullDuplexTransfer(std::get<1>(item), response);
+        result = FullDuplexTransfer(commandFrame, response);
         
         if (!result)
         {
-            result = FullDuplexTransfer(std::get<1>(item), response);
+            result = FullDuplexTransfer(commandFrame, response);
             if (!result)
             {   
-                using TupleMemberVariable_t = typename std::tuple_element<2, std::decay_t<decltype(item)> >::type;
-                // What is the type of the sensor data in this particular case? 
-                result = ValidateSPIResponseFrame<TupleMemberVariable_t>(
-                        std::get<2>(item), 
-                        std::get<1>(item), 
+                // Previous reading is retained should validation fail.
+                uint16_t value = m_LatestSample.GetUnsigned(channel);
+                result = ValidateSPIResponseFrame<uint16_t>(
+                        value, 
+                        commandFrame, 
                         response);
                         
+                m_LatestSample.Set(channel, value, GetReturnStatus(response));
+                
                 if (!result)
                 {
-                    printf("Success! %s: \n\t[%d] -> Successfully retrieved"
-                        " sensor data from the SCL3300 sensor device.\n\t%s\n", 
-                        __PRETTY_FUNCTION__,
-                        result.value(), 
-                        std::get<3>(item).c_str());
-                }
-                else
-                {
-                    printf("Error! %s: \n\t[%d] -> %s\n\t%s\n", __PRETTY_FUNCTION__,
-                        result.value(), result.message().c_str(), 
-                        std::get<3>(item).c_str());
+                    m_EventLog.template Record<DriverEvent_t::SENSOR_DATA_READ>(
+                        channelIndex, static_cast<int16_t>(value));
                 }
             }
-            else
-            {
-                printf("Error! %s: \n\t[%d] -> %s\n\t%s\n", __PRETTY_FUNCTION__,
-                    result.value(), result.message().c_str(), 
-                    std::get<3>(item).c_str());
-            }
-        }
-        else
-        {
-            printf("Error! %s: \n\t[%d] -> %s\n\t%s\n", __PRETTY_FUNCTION__,
-                result.value(), result.message().c_str(), 
-                std::get<3>(item).c_str());
         }
     }
-    else
+
+    if (result)
     {
-        printf("Error! %s: \n\t[%d] -> %s\n\t%s\n", __PRETTY_FUNCTION__,
-            result.value(), result.message().c_str(), 
-            std::get<3>(item).c_str());
+        m_EventLog.template Record<DriverEvent_t::SENSOR_DATA_READ_FAILED>(
+            result.value(), channelIndex);
     }
 }
 
-void NuerteySCL3300Device::ReadAllSensorData()
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::ReadAllSensorData()
 {       
-    // Loop through the global instance of SCL3300SensorData_t tuple and 
-    // retrieve each of its composed member variables the types of which
-    // are std::tuples themselves:
-    std::apply([&](auto& ...item)
-    {    
-        (..., ReadSensorData<decltype(item)>(item));
-    }, g_TheSensorData);
+    const auto timestamp = MonotonicClock_t::now();
+    
+    // Loop through every channel of the latest sample and retrieve each
+    // one in turn:
+    for (std::size_t index = 0; index < NUMBER_OF_CHANNELS; ++index)
+    {
+        ReadSensorData(static_cast<Channel_t>(index));
+    }
+    
+    m_LatestSample.m_Timestamp = timestamp;
+    ++m_LatestSample.m_SequenceNumber;
     
     // \" SELBANK - Switch between active register banks
     //
@@ -1016,15 +2129,609 @@ void NuerteySCL3300Device::ReadAllSensorData()
     // bank #1 is required, for example, reading serial number of sensor.
     // After using bank #1 user should switch back to bank #0. \"
     SPICommandFrame_t ignoredResponse = {}; // Initialize to zeros.
-    FullDuplexTransfer(SWITCH_TO_BANK_0, ignoredResponse);
+    SelectBank(SWITCH_TO_BANK_0, ignoredResponse);
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ReadRegistersPipelined(
+                                   std::span<const RegisterRead_t> reads,
+                                   std::span<uint16_t> values,
+                                   std::span<uint8_t> returnStatuses)
+{
+    assert(((void)"Pipelined read values span is too small!",
+        (values.size() >= reads.size())));
+    assert(((void)"Too many reads for a single pipelined burst!",
+        (reads.size() <= MAXIMUM_PIPELINED_READS)));
+
+    // \" ... Due to off-frame protocol of SPI the first response to
+    // MOSI command is a response to earlier MOSI command and is thus
+    // not applicable... \"
+    //
+    // Rather than transmitting each read command twice, exploit the
+    // off-frame protocol as designed: the response to frame k arrives
+    // during frame k+1. Each transmitted frame therefore also collects
+    // the answer to the read command that preceded it. Reads are grouped
+    // by memory bank, starting with the active bank, so that SELBANK
+    // frames are only spent where the bank truly changes.
+    const auto train = ComposeFrameTrain(reads, m_ActiveBank);
+    m_BankSwitchesAvoided += train.m_BankSwitchesAvoided;
+
+    return ExecuteFrameTrain(train, reads, values, returnStatuses);
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ExecuteFrameTrain(
+                                   const FrameTrain_t& train,
+                                   std::span<const RegisterRead_t> reads,
+                                   std::span<uint16_t> values,
+                                   std::span<uint8_t> returnStatuses)
+{
+    FrameTrainCursor_t cursor{&train, reads, values, returnStatuses};
+
+    while (!cursor.IsComplete())
+    {
+        auto status = TransferNextFrame(cursor);
+        if (status)
+        {
+            return status;
+        }
+    }
+
+    return cursor.m_Result;
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::TransferNextFrame(FrameTrainCursor_t& cursor)
+{
+    if (cursor.IsComplete())
+    {
+        return cursor.m_Result;
+    }
+
+    const auto& train = *cursor.m_Train;
+    const auto  index = cursor.m_Index;
+
+    auto validateResponse = [&](const std::size_t& frame)
+    {
+        const auto answer = train.m_Answers[frame];
+        if (answer != NO_PENDING_READ)
+        {
+            const auto& response = cursor.m_Responses[frame % cursor.m_Responses.size()];
+            if (!cursor.m_ReturnStatuses.empty())
+            {
+                cursor.m_ReturnStatuses[answer] = GetReturnStatus(response);
+            }
+
+            auto status = ValidateSPIResponseFrame<uint16_t>(
+                    cursor.m_Values[answer],
+                    cursor.m_Reads[answer].second,
+                    response);
+
+            // Remember the first failure but keep collecting the rest
+            // of the burst.
+            if (status && !cursor.m_Result)
+            {
+                cursor.m_Result = status;
+            }
+        }
+    };
+
+    auto status = FullDuplexTransfer(train.m_Frames[index], 
+                                     cursor.m_Responses[index % cursor.m_Responses.size()],
+                                     [&]()
+                                     {
+                                         if (index > 0)
+                                         {
+                                             validateResponse(index - 1);
+                                         }
+                                     });
+    if (status)
+    {
+        // The rest of the train is abandoned.
+        cursor.m_Index  = train.m_Length;
+        cursor.m_Result = status;
+        return status;
+    }
+
+    if (++cursor.m_Index == train.m_Length)
+    {
+        validateResponse(index);
+    }
+
+    return {};
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ReadAllSensorDataPipelined()
+{
+    auto result = ReadChannelsPipelined(ALL_CHANNELS);
+
+    if (result)
+    {
+        m_EventLog.template Record<DriverEvent_t::PIPELINED_READ_FAILED>(result.value());
+    }
+
+    return result;
 }
 
-std::error_code NuerteySCL3300Device::ClearStatusSummaryRegister()
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ReadChannelsPipelined(const ChannelSet_t& channels)
+{
+    ChannelSweep_t sweep;
+
+    auto result = BeginChannelSweep(sweep, channels);
+    if (!result)
+    {
+        while (!sweep.m_Cursor.IsComplete())
+        {
+            TransferNextFrame(sweep.m_Cursor);
+        }
+
+        result = ConcludeChannelSweep(sweep);
+    }
+
+    return result;
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::BeginChannelSweep(ChannelSweep_t& sweep,
+                                                                   const ChannelSet_t& channels)
+{
+    sweep.m_Channels = channels;
+    sweep.m_Cursor   = FrameTrainCursor_t{};
+
+    const auto count = GatherSensorDataReads(channels, sweep.m_Reads, sweep.m_Values);
+    if (count == 0)
+    {
+        return make_error_code(SensorStatus_t::ERROR_EMPTY_CHANNEL_SET);
+    }
+
+    const auto reads = std::span<const RegisterRead_t>(sweep.m_Reads).first(count);
+
+    // As per ReadRegistersPipelined(). The bank is presumed to remain as
+    // it is until the train is under way; i.e. issue no other traffic to
+    // this device in between.
+    sweep.m_Train = ComposeFrameTrain(reads, m_ActiveBank);
+    m_BankSwitchesAvoided += sweep.m_Train.m_BankSwitchesAvoided;
+
+    sweep.m_Cursor = FrameTrainCursor_t{&sweep.m_Train, 
+                                        reads,
+                                        std::span(sweep.m_Values).first(count),
+                                        std::span(sweep.m_ReturnStatuses).first(count)};
+    sweep.m_Timestamp = MonotonicClock_t::now();
+
+    return {};
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ConcludeChannelSweep(ChannelSweep_t& sweep)
+{
+    ScatterSensorDataValues(sweep.m_Channels, sweep.m_Values, sweep.m_ReturnStatuses, sweep.m_Timestamp);
+
+    const auto result = sweep.m_Cursor.m_Result;
+    if (!result)
+    {
+        RecordFirstSample();
+    }
+
+    return result;
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+template <Channel_t... Channels>
+    requires ValidChannelList<Channels...>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ReadChannels()
+{
+    using Plan_t = ChannelReadPlan_t<Channels...>;
+
+    // Seeded with the current readings so that a failed register read
+    // leaves its previous reading intact.
+    std::array<uint16_t, Plan_t::NUMBER_OF_READS> values{m_LatestSample.GetUnsigned(Channels)...};
+    std::array<uint8_t, Plan_t::NUMBER_OF_READS>  returnStatuses{};
+
+    const auto  isBank0Active = (m_ActiveBank == MemoryBank_t::BANK_0);
+    const auto& train         = isBank0Active ? Plan_t::TRAIN_FROM_BANK_0
+                                              : Plan_t::TRAIN_FROM_UNKNOWN_BANK;
+    m_BankSwitchesAvoided += train.m_BankSwitchesAvoided;
+
+    const auto timestamp = MonotonicClock_t::now();
+    auto result = ExecuteFrameTrain(train, Plan_t::READS, values, returnStatuses);
+
+    for (std::size_t index = 0; index < Plan_t::NUMBER_OF_READS; ++index)
+    {
+        m_LatestSample.Set(Plan_t::CHANNELS[index], values[index], returnStatuses[index]);
+    }
+
+    m_LatestSample.m_Timestamp = timestamp;
+    ++m_LatestSample.m_SequenceNumber;
+
+    if (!result)
+    {
+        RecordFirstSample();
+    }
+
+    return result;
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+template <Channel_t Channel>
+    requires (Channel < Channel_t::NUMBER_OF_CHANNELS)
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::StreamChannel(int16_t& value)
+{
+    constexpr auto& bankFrame    = CHANNEL_READS[ToUnderlyingType(Channel)].first;
+    constexpr auto& commandFrame = CHANNEL_READS[ToUnderlyingType(Channel)].second;
+
+    AssertValidSPICommandFrame<bankFrame>();
+    AssertValidSPICommandFrame<commandFrame>();
+
+    std::error_code result{};
+    SPICommandFrame_t response = {}; // Initialize to zeros.
+
+    // \" ... Due to off-frame protocol of SPI the first response to 
+    // MOSI command is a response to earlier MOSI command and is thus
+    // not applicable... \"
+    //
+    // Unless this very read went out in the previous frame, its answer
+    // is not yet in the pipeline.
+    if (m_LastCommandFrame != commandFrame)
+    {
+        ++m_StreamStatistics.m_Primes;
+
+        result = SelectBank(bankFrame, response);
+        if (!result)
+        {
+            result = FullDuplexTransfer(commandFrame, response);
+        }
+    }
+
+    // Timed from here, so that a priming read does not skew the steady-
+    // state latencies by its two extra frames.
+    const auto startTime = MonotonicClock_t::now();
+
+    if (!result)
+    {
+        result = FullDuplexTransfer(commandFrame, response);
+        if (!result)
+        {
+            // Previous reading is retained should validation fail.
+            uint16_t raw = m_LatestSample.GetUnsigned(Channel);
+            result = ValidateSPIResponseFrame<uint16_t>(raw, commandFrame, response);
+
+            m_LatestSample.Set(Channel, raw, GetReturnStatus(response));
+            value = static_cast<int16_t>(raw);
+        }
+    }
+
+    if (!result)
+    {
+        m_StreamStatistics.Record(std::chrono::duration_cast<MicroSecs_t>(
+                                      MonotonicClock_t::now() - startTime));
+    }
+    else
+    {
+        ++m_StreamStatistics.m_Failures;
+    }
+
+    return result;
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::PrintStreamStatistics() const
+{
+    const auto& statistics = m_StreamStatistics;
+
+    printf("\nStreamed Read Statistics:\n");
+    printf("\tReads                   := [%lu]\n", static_cast<unsigned long>(statistics.m_Reads));
+    printf("\tFailures                := [%lu]\n", static_cast<unsigned long>(statistics.m_Failures));
+    printf("\tPipeline Primes         := [%lu]\n", static_cast<unsigned long>(statistics.m_Primes));
+
+    if (statistics.m_Reads > 0)
+    {
+        printf("\tLatency (min/mean/max)  := [%lld/%lld/%lld us]\n",
+            static_cast<long long>(statistics.m_MinimumLatency.count()),
+            static_cast<long long>(statistics.GetMeanLatency().count()),
+            static_cast<long long>(statistics.m_MaximumLatency.count()));
+
+        for (std::size_t bin = 0; bin < statistics.m_LatencyHistogram.size(); ++bin)
+        {
+            const bool isLastBin = ((bin + 1) == statistics.m_LatencyHistogram.size());
+
+            if (statistics.m_LatencyHistogram[bin] > 0)
+            {
+                printf("\t\t%s %5lu us := [%lu]\n", 
+                    isLastBin ? ">=" : "< ",
+                    isLastBin ? (1UL << (bin - 1)) : (1UL << bin),
+                    static_cast<unsigned long>(statistics.m_LatencyHistogram[bin]));
+            }
+        }
+    }
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::size_t NuerteySCL3300Device<Transport_t, Mode_t>::PrintEventLog(const std::size_t& maximum)
+{
+    const auto dropped = m_EventLog.GetDroppedCount();
+    
+    const auto count = m_EventLog.Drain([](std::span<const Diagnostics::LogEvent_t> events)
+    {
+        for (const auto& event : events)
+        {
+            PrintLogEvent(event);
+        }
+    }, maximum);
+
+    if (dropped > m_ReportedDroppedEvents)
+    {
+        printf("Warning! %lu event(s) dropped from the log.\n", 
+               static_cast<unsigned long>(dropped - m_ReportedDroppedEvents));
+        m_ReportedDroppedEvents = dropped;
+    }
+
+    return count;
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::size_t NuerteySCL3300Device<Transport_t, Mode_t>::GatherSensorDataReads(const ChannelSet_t& channels,
+                                                        std::span<RegisterRead_t> reads,
+                                                        std::span<uint16_t> values) const
+{
+    // Gather the frames of the selected channels, in sweep order. Values
+    // are seeded with the current readings so that a failed register 
+    // read leaves its previous reading intact.
+    std::size_t count = 0;
+
+    for (std::size_t index = 0; index < NUMBER_OF_CHANNELS; ++index)
+    {
+        if (channels.test(index))
+        {
+            reads[count]  = CHANNEL_READS[index];
+            values[count] = static_cast<uint16_t>(m_LatestSample.m_Raw[index]);
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::size_t NuerteySCL3300Device<Transport_t, Mode_t>::ScatterSensorDataValues(const ChannelSet_t& channels,
+                                                          std::span<const uint16_t> values,
+                                                          std::span<const uint8_t> returnStatuses,
+                                                          const MonotonicClock_t::time_point& timestamp)
+{
+    // Scatter the retrieved register values back into the latest sample,
+    // alongside the RS bits of their responses.
+    std::size_t count = 0;
+
+    for (std::size_t index = 0; index < NUMBER_OF_CHANNELS; ++index)
+    {
+        if (channels.test(index))
+        {
+            m_LatestSample.Set(static_cast<Channel_t>(index), values[count], returnStatuses[count]);
+            ++count;
+        }
+    }
+
+    m_LatestSample.m_Timestamp = timestamp;
+    ++m_LatestSample.m_SequenceNumber;
+
+    return count;
+}
+
+#if DEVICE_SPI_ASYNCH
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::StartFrameTrainAsync(
+                                   const FrameTrain_t& train,
+                                   std::span<const RegisterRead_t> reads,
+                                   std::span<uint16_t> values,
+                                   TransferCompletion_t onComplete,
+                                   std::span<uint8_t> returnStatuses)
+{
+    if (m_AsyncTransferInProgress.exchange(true))
+    {
+        return make_error_code(SensorStatus_t::ERROR_TRANSFER_IN_PROGRESS);
+    }
+
+    return LaunchFrameTrainAsync(train, reads, values, onComplete, returnStatuses);
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::LaunchFrameTrainAsync(
+                                   const FrameTrain_t& train,
+                                   std::span<const RegisterRead_t> reads,
+                                   std::span<uint16_t> values,
+                                   TransferCompletion_t onComplete,
+                                   std::span<uint8_t> returnStatuses)
+{
+    if (train.m_Length == 0)
+    {
+        m_AsyncTransferInProgress = false;
+        return std::error_code{};
+    }
+
+    // The train is copied so that callers need not keep it alive. The
+    // reads and values spans however must outlive the transfer.
+    m_AsyncTrain      = train;
+    m_AsyncReads      = reads;
+    m_AsyncValues     = values;
+    m_AsyncReturnStatuses = returnStatuses;
+    m_AsyncFrameIndex = 0;
+    m_AsyncResult     = std::error_code{};
+    m_AsyncCompletion = onComplete;
+
+    // Honour whatever remains of the inter-frame gap since the frame
+    // which was transmitted last.
+    const auto remainingGap = RemainingInterFrameGap();
+    if (remainingGap > MicroSecs_t(0))
+    {
+        m_InterFrameTimeout.attach(mbed::callback(this, &NuerteySCL3300Device::TransferNextAsyncFrame),
+                                   remainingGap);
+    }
+    else
+    {
+        TransferNextAsyncFrame();
+    }
+
+    return std::error_code{};
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ReadAllSensorDataAsync(TransferCompletion_t onComplete)
+{
+    // Claim the transfer before touching any of the sweep state; a
+    // concurrent caller would otherwise overwrite it mid-flight. Released
+    // by CompleteAsyncTransfer(), or by LaunchFrameTrainAsync() itself
+    // should there be nothing to transfer.
+    if (m_AsyncTransferInProgress.exchange(true))
+    {
+        return make_error_code(SensorStatus_t::ERROR_TRANSFER_IN_PROGRESS);
+    }
+
+    GatherSensorDataReads(ALL_CHANNELS, m_SweepReads, m_SweepValues);
+    m_SweepTimestamp = MonotonicClock_t::now();
+
+    const auto train = ComposeFrameTrain(m_SweepReads, m_ActiveBank);
+    m_BankSwitchesAvoided += train.m_BankSwitchesAvoided;
+    m_SweepCompletion      = onComplete;
+
+    return LaunchFrameTrainAsync(train, m_SweepReads, m_SweepValues,
+                   mbed::callback(this, &NuerteySCL3300Device::OnAsyncSweepComplete),
+                   m_SweepReturnStatuses);
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::TransferNextAsyncFrame()
+{
+    // Note that this executes in interrupt context.
+    const auto& frame = m_AsyncTrain.m_Frames[m_AsyncFrameIndex];
+
+    // Write to the SPI Slave and obtain the response by way of DMA. The 
+    // frame's completion, validation included, is then handled within
+    // OnAsyncFrameComplete().
+    auto status = m_TheSPIBus.transfer(frame.data(), 
+                                       static_cast<int>(frame.size()),
+                                       m_AsyncResponse, 
+                                       static_cast<int>(frame.size()),
+                                       mbed::callback(this, &NuerteySCL3300Device::OnAsyncFrameComplete),
+                                       SPI_EVENT_ALL);
+    if (status != 0)
+    {
+        CompleteAsyncTransfer(make_error_code(SensorStatus_t::ERROR_INCORRECT_NUMBER_OF_BYTES_WRITTEN));
+    }
+    else
+    {
+        m_SPIFrameCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::OnAsyncFrameComplete(int event)
+{
+    // Note that this executes in interrupt context.
+    m_LastSPITransferTime = MonotonicClock_t::now();
+
+    const auto& frame = m_AsyncTrain.m_Frames[m_AsyncFrameIndex];
+
+    std::error_code status{};
+    if (!(event & SPI_EVENT_COMPLETE) || (event & SPI_EVENT_ERROR))
+    {
+        status = make_error_code(SensorStatus_t::ERROR_INCORRECT_NUMBER_OF_BYTES_WRITTEN);
+    }
+
+    TrackSensorState(frame, status);
+
+    if (status)
+    {
+        CompleteAsyncTransfer(status);
+        return;
+    }
+
+    const auto answer = m_AsyncTrain.m_Answers[m_AsyncFrameIndex];
+    if (answer != NO_PENDING_READ)
+    {
+        SPICommandFrame_t response = {}; // Initialize to zeros.
+        std::copy_n(m_AsyncResponse.data(), response.size(), response.begin());
+
+        if (!m_AsyncReturnStatuses.empty())
+        {
+            m_AsyncReturnStatuses[answer] = GetReturnStatus(response);
+        }
+
+        // Print-free; diagnostics are merely recorded, the event log
+        // being wait-free and, whilst the transfer is in progress, ours.
+        status = ValidateSPIResponseFrame<uint16_t>(
+                m_AsyncValues[answer],
+                m_AsyncReads[answer].second,
+                response);
+
+        // Remember the first failure but keep collecting the rest of the
+        // train.
+        if (status && !m_AsyncResult)
+        {
+            m_AsyncResult = status;
+        }
+    }
+
+    if (++m_AsyncFrameIndex < m_AsyncTrain.m_Length)
+    {
+        // \"NOTE: For sensor operation, time between consecutive SPI requests (i.e. CSB
+        // high) must be at least 10 µs. If less than 10 µs is used, output data will be
+        // corrupted. \"
+        //
+        // The validation above has already consumed part of the gap. 
+        // Rather than spin in interrupt context for the remainder, have a
+        // Timeout kick off the next frame once it has elapsed.
+        const auto remainingGap = RemainingInterFrameGap();
+        if (remainingGap > MicroSecs_t(0))
+        {
+            m_InterFrameTimeout.attach(mbed::callback(this, &NuerteySCL3300Device::TransferNextAsyncFrame),
+                                       remainingGap);
+        }
+        else
+        {
+            TransferNextAsyncFrame();
+        }
+    }
+    else
+    {
+        CompleteAsyncTransfer(m_AsyncResult);
+    }
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::CompleteAsyncTransfer(const std::error_code& result)
+{
+    m_AsyncTransferInProgress = false;
+
+    if (m_AsyncCompletion)
+    {
+        m_AsyncCompletion(result);
+    }
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::OnAsyncSweepComplete(std::error_code result)
+{
+    ScatterSensorDataValues(ALL_CHANNELS, m_SweepValues, m_SweepReturnStatuses, m_SweepTimestamp);
+
+    if (!result)
+    {
+        RecordFirstSample();
+    }
+
+    if (m_SweepCompletion)
+    {
+        m_SweepCompletion(result);
+    }
+}
+#endif
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ClearStatusSummaryRegister()
 {
     // Safety check.
-    AssertValidSPICommandFrame<SPICommandFrame_t>(SWITCH_TO_BANK_1);
-    AssertValidSPICommandFrame<SPICommandFrame_t>(READ_STATUS_SUMMARY);
-    AssertValidSPICommandFrame<SPICommandFrame_t>(SWITCH_TO_BANK_0);
+    AssertValidSPICommandFrame<READ_STATUS_SUMMARY>();
+    AssertValidSPICommandFrame<SWITCH_TO_BANK_0>();
     
     std::error_code result{};
     
@@ -1039,7 +2746,7 @@ std::error_code NuerteySCL3300Device::ClearStatusSummaryRegister()
     // recommended to keep memory bank #0 selected unless register from
     // bank #1 is required, for example, reading serial number of sensor.
     // After using bank #1 user should switch back to bank #0. \"
-    result = FullDuplexTransfer(SWITCH_TO_BANK_1, response);
+    result = SelectBank(SWITCH_TO_BANK_0, response);
     if (!result)
     {
         // Per requirements, section 6.3.1, transmit MOSI 4 times in order 
@@ -1054,51 +2761,33 @@ std::error_code NuerteySCL3300Device::ClearStatusSummaryRegister()
                 result = FullDuplexTransfer(READ_STATUS_SUMMARY, response);
                 if (!result)
                 {   
-                    // What is the type of the sensor data in this particular case? 
+                    uint16_t status = m_LatestSample.GetUnsigned(Channel_t::STATUS_SUMMARY);
                     result = ValidateSPIResponseFrame<uint16_t>(
-                            std::get<2>(std::get<8>(g_TheSensorData)), 
+                            status, 
                             READ_STATUS_SUMMARY, 
                             response);
                             
+                    m_LatestSample.Set(Channel_t::STATUS_SUMMARY, status, GetReturnStatus(response));
+                    
                     if (!result)
                     {
-                        result = ConvertStatusSummaryToErrorCode(std::get<2>(std::get<8>(g_TheSensorData)));
-                        if ((!result) && (count = 3))
-                        {
-                            printf("Success! %s: \n\t[%d] -> Completed clearing"
-                                " the STATUS Summary register.\n", 
-                                __PRETTY_FUNCTION__,
-                                result.value());
-                        }                   
-                        else
-                        {
-                            printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                                      result.value(), result.message().c_str());
-                        }
-                    }
-                    else
-                    {
-                        printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                                  result.value(), result.message().c_str());
+                        result = ConvertStatusSummaryToErrorCode(status);
                     }
                 }
-                else
-                {
-                    printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                              result.value(), result.message().c_str());
-                }
             }
         }
-        else
-        {
-            printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                      result.value(), result.message().c_str());
-        }
+    }
+
+    // Only the last of the reads decides the outcome; the earlier ones
+    // are expected to flag (RS '11') whatever is being cleared.
+    if (!result)
+    {
+        m_EventLog.template Record<DriverEvent_t::STATUS_SUMMARY_CLEARED>(
+            m_LatestSample.GetUnsigned(Channel_t::STATUS_SUMMARY));
     }
     else
     {
-        printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                  result.value(), result.message().c_str());
+        m_EventLog.template Record<DriverEvent_t::STATUS_SUMMARY_CLEAR_FAILED>(result.value());
     }
     
     // \" SELBANK - Switch between active register banks
@@ -1107,13 +2796,14 @@ std::error_code NuerteySCL3300Device::ClearStatusSummaryRegister()
     // recommended to keep memory bank #0 selected unless register from
     // bank #1 is required, for example, reading serial number of sensor.
     // After using bank #1 user should switch back to bank #0. \"
-    FullDuplexTransfer(SWITCH_TO_BANK_0, response);
+    SelectBank(SWITCH_TO_BANK_0, response);
     
     return result;
 }
 
+template <SPITransport Transport_t, ModePolicy Mode_t>
 template <typename T>
-std::error_code NuerteySCL3300Device::ValidateSPIResponseFrame(T& sensorData,
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ValidateSPIResponseFrame(T& sensorData,
                                 const SPICommandFrame_t& commandFrame,
                                 const SPICommandFrame_t& responseFrame)
 {
@@ -1141,23 +2831,18 @@ std::error_code NuerteySCL3300Device::ValidateSPIResponseFrame(T& sensorData,
         {
             if (commandFrame == READ_STATUS_SUMMARY)
             {
-                static bool startupIndication = true;
-                
                 if (returnStatusMISO == ToUnderlyingType(ReturnStatus_t::NORMAL_OPERATION_NO_FLAGS))
                 {
-                    if (startupIndication)
+                    if (!m_StartupIndicated)
                     {
-                        startupIndication = false;
+                        m_StartupIndicated = true;
                         
-                        printf("Success! %s: \n\t[%d] -> First response where STATUS has been"
-                               " cleared. RS bits are indicating proper start-up.\n", 
-                            __PRETTY_FUNCTION__,
-                            returnStatusMISO);
+                        m_EventLog.template Record<DriverEvent_t::STARTUP_INDICATED>(returnStatusMISO);
                     }
                 }
                 else
                 {
-                    printf("Warning! Start-up has not been performed correctly.\n");
+                    m_EventLog.template Record<DriverEvent_t::STARTUP_NOT_INDICATED>(returnStatusMISO);
                 }
             }
             
@@ -1187,6 +2872,13 @@ std::error_code NuerteySCL3300Device::ValidateSPIResponseFrame(T& sensorData,
                 //
                 // \" Read STATUS. ‘11’ Clear status summary. Reset status summary \"
                 result = make_error_code(SensorStatus_t::ERROR_RETURN_STATUS_STARTUP_IN_PROGRESS);              
+
+                // Keep the flags regardless; they are what explain the RS
+                // bits, and reading STATUS has just cleared them.
+                if (receivedOpCodeAddress == commandOpCodeAddress)
+                {
+                    sensorData = receivedSensorData;
+                }
             }
             else
             {
@@ -1195,7 +2887,7 @@ std::error_code NuerteySCL3300Device::ValidateSPIResponseFrame(T& sensorData,
                 // changed, and write command must be discarded. \"
                 
                 // Should never happen due to provision of proactive static
-                // assert, ProtocolDefinitions::AssertValidSPICommandFrame<T>().
+                // assert, ProtocolDefinitions::AssertValidSPICommandFrame<V>().
                 // Still, if the sensor responds that it is so, react on it.
                 result = make_error_code(SensorStatus_t::ERROR_INVALID_COMMAND_FRAME); 
             }
@@ -1205,7 +2897,8 @@ std::error_code NuerteySCL3300Device::ValidateSPIResponseFrame(T& sensorData,
     return result;
 }
 
-std::error_code NuerteySCL3300Device::ValidateCRC(const SPICommandFrame_t& frame)
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ValidateCRC(const SPICommandFrame_t& frame)
 {
     std::error_code result{};
     
@@ -1224,8 +2917,18 @@ std::error_code NuerteySCL3300Device::ValidateCRC(const SPICommandFrame_t& frame
     return result;        
 }
 
-std::error_code NuerteySCL3300Device::FullDuplexTransfer(
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::FullDuplexTransfer(
            const SPICommandFrame_t& cBuffer, SPICommandFrame_t& rBuffer)
+{
+    return FullDuplexTransfer(cBuffer, rBuffer, [](){});
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+template <typename F>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::FullDuplexTransfer(
+           const SPICommandFrame_t& cBuffer, SPICommandFrame_t& rBuffer,
+           F&& gapWork)
 {
     std::error_code result{};
     
@@ -1237,32 +2940,44 @@ std::error_code NuerteySCL3300Device::FullDuplexTransfer(
     // Do not presume that the users of this OS-abstraction are well-behaved.
     rBuffer.fill(0);
 
+#if DEVICE_SPI_ASYNCH
+    // Blocking transfers must not interleave with a queued frame train.
+    if (m_AsyncTransferInProgress)
+    {
+        return make_error_code(SensorStatus_t::ERROR_TRANSFER_IN_PROGRESS);
+    }
+#endif
+
     //DisplayFrame(cBuffer);
     
     if (cBuffer == SWITCH_TO_BANK_0)
     {
-        printf("Switching the SCL3300 sensor operations to memory bank 0...\n");
+        m_EventLog.template Record<DriverEvent_t::BANK_SWITCHED>(0);
     }
     else if (cBuffer == SWITCH_TO_BANK_1)
     {
-        printf("Switching the SCL3300 sensor operations to memory bank 1...\n");       
+        m_EventLog.template Record<DriverEvent_t::BANK_SWITCHED>(1);
     }
     
-    // Enforce the 10 us SPI transfer interval requirement with my 
-    // customized Clock_t:
-    auto currentTime = NucleoF767ZIClock_t::now();
+    // Put the inter-frame gap to good use first.
+    std::forward<F>(gapWork)();
 
     // \"NOTE: For sensor operation, time between consecutive SPI requests (i.e. CSB
     // high) must be at least 10 µs. If less than 10 µs is used, output data will be
     // corrupted. \"
     
-    // Note to only escape the <chrono> system with '.count()' only when
-    // you absolutely must. Also, note that the statement below 
-    // constitutes a busy-wait.
-    while (std::chrono::duration_cast<MicroSecs_t>(currentTime - m_LastSPITransferTime).count()
-         < MINIMUM_TIME_BETWEEN_SPI_CYCLES_MICROSECS)
+    // Enforce the 10 us SPI transfer interval requirement with the 
+    // microsecond-resolution MonotonicClock_t, waiting out exactly what 
+    // remains of it. Note that the statement below constitutes a 
+    // busy-wait, albeit one no longer than 10 us.
+    if constexpr (RequiresInterFrameGap<Transport_t>())
     {
-    };
+        const auto gapDeadline = m_LastSPITransferTime 
+                               + MicroSecs_t(MINIMUM_TIME_BETWEEN_SPI_CYCLES_MICROSECS);
+        while (MonotonicClock_t::now() < gapDeadline)
+        {
+        };
+    }
 
     // Assert the Slave Select line, acquiring exclusive access to the
     // SPI bus. Chip select is active low hence cs = 0 here. Note that
@@ -1280,7 +2995,8 @@ std::error_code NuerteySCL3300Device::FullDuplexTransfer(
                                                  reinterpret_cast<char*>(rBuffer.data()), 
                                                  rBuffer.size());
 
-    m_LastSPITransferTime = NucleoF767ZIClock_t::now();
+    m_LastSPITransferTime = MonotonicClock_t::now();
+    m_SPIFrameCount.fetch_add(1, std::memory_order_relaxed);
     
     // Deassert the Slave Select line, releasing exclusive access to the
     // SPI bus. Chip select is active low hence cs = 1 here.  Note that
@@ -1292,13 +3008,78 @@ std::error_code NuerteySCL3300Device::FullDuplexTransfer(
     // transmission success. Reception will be validated elsewhere.
     if (bytesWritten != std::max(cBuffer.size(), rBuffer.size()))
     {
-        result = make_error_code(SensorStatus_t::ERROR_INCORRECT_NUMBER_OF_BYTES_WRITTEN);
+        result = make_error_code(SensorStatus_t::ERROR_INCORRECT_NUMBER_OF_BYTES_WRITTEN);
+    }
+    
+    TrackSensorState(cBuffer, result);
+    
+    return result;    
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+MicroSecs_t NuerteySCL3300Device<Transport_t, Mode_t>::RemainingInterFrameGap() const
+{
+    if constexpr (!RequiresInterFrameGap<Transport_t>())
+    {
+        return MicroSecs_t(0);
+    }
+
+    const auto elapsed = std::chrono::duration_cast<MicroSecs_t>(
+                             MonotonicClock_t::now() - m_LastSPITransferTime);
+    
+    return std::max(MicroSecs_t(MINIMUM_TIME_BETWEEN_SPI_CYCLES_MICROSECS) - elapsed,
+                    MicroSecs_t(0));
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::SelectBank(
+           const SPICommandFrame_t& bankFrame, SPICommandFrame_t& rBuffer)
+{
+    std::error_code result{};
+    
+    if (IsBankActive(bankFrame))
+    {
+        ++m_BankSwitchesAvoided;
+    }
+    else
+    {
+        result = FullDuplexTransfer(bankFrame, rBuffer);
     }
     
-    return result;    
+    return result;
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+bool NuerteySCL3300Device<Transport_t, Mode_t>::IsBankActive(const SPICommandFrame_t& bankFrame) const
+{
+    return (m_ActiveBank == ToMemoryBank(bankFrame));
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::TrackSensorState(const SPICommandFrame_t& cBuffer,
+                                           const std::error_code& result)
+{
+    // Whatever the sensor makes of a mangled frame, it is not what was
+    // intended; hence forget the last frame altogether.
+    m_LastCommandFrame = result ? SPICommandFrame_t{} : cBuffer;
+
+    if ((cBuffer == SWITCH_TO_BANK_0) || (cBuffer == SWITCH_TO_BANK_1))
+    {
+        // Should the SELBANK frame not have gone out intact, the sensor's
+        // active bank can no longer be presumed.
+        m_ActiveBank = result ? std::nullopt 
+                              : std::optional<MemoryBank_t>(ToMemoryBank(cBuffer));
+    }
+    else if ((cBuffer == SOFTWARE_RESET) || (cBuffer == SET_POWERDOWN_MODE))
+    {
+        // \" Power-cycle, reset and power down mode will reset all 
+        // written settings. \" Default register bank is #0.
+        m_ActiveBank = MemoryBank_t::BANK_0;
+    }
 }
 
-double NuerteySCL3300Device::ConvertAcceleration(const int16_t& accelaration) const
+template <SPITransport Transport_t, ModePolicy Mode_t>
+double NuerteySCL3300Device<Transport_t, Mode_t>::ConvertAcceleration(const int16_t& accelaration) const
 {
     double result{0.0};
     
@@ -1323,33 +3104,18 @@ double NuerteySCL3300Device::ConvertAcceleration(const int16_t& accelaration) co
     // 
     // Mode 4
     // Inclination mode 10 Hz 1st order low pass filter. Low noise mode \"
-    if (OperationMode_t::MODE_1 == m_InclinometerMode)
-    { 
-        // Since we must be wary of precision loss, pre-cast the operands:
-        // Note MODE_1 sensitivity (6000 LSB/g).
-        result = static_cast<double>(accelaration) 
-               / static_cast<double>(6000); // Convert 2's complement to g.  
-    }
-    else if (OperationMode_t::MODE_2 == m_InclinometerMode)
-    {
-        // Since we must be wary of precision loss, pre-cast the operands:
-        // Note MODE_2 sensitivity (3000 LSB/g).
-        result = static_cast<double>(accelaration) 
-               / static_cast<double>(3000); // Convert 2's complement to g. 
-    }
-    else if ((OperationMode_t::MODE_3 == m_InclinometerMode)
-          || (OperationMode_t::MODE_4 == m_InclinometerMode))
-    {
-        // Since we must be wary of precision loss, pre-cast the operands:
-        // Note MODE_3 and MODE_4 sensitivity (12000 LSB/g).
-        result = static_cast<double>(accelaration) 
-               / static_cast<double>(12000); // Convert 2's complement to g. 
-    }
+    //
+    // The sensitivity of the current mode is cached upon each mode change.
+    // Multiplying by its reciprocal spares both the branching upon the
+    // mode and a division per sample.
+    result = static_cast<double>(accelaration) 
+           * GetModeProfile().m_ScaleFactors.m_AccelerationGPerLSB; // Convert 2's complement to g.
     
     return result;
 }
 
-double NuerteySCL3300Device::ConvertAngle(const int16_t& angle) const
+template <SPITransport Transport_t, ModePolicy Mode_t>
+double NuerteySCL3300Device<Transport_t, Mode_t>::ConvertAngle(const int16_t& angle) const
 {
     double result{0.0};
     
@@ -1368,14 +3134,14 @@ double NuerteySCL3300Device::ConvertAngle(const int16_t& angle) const
     // 
     // where d'ANG_% is angle output register (ANG_X, ANG_Y, ANG_Z) content in decimal
     // format. See 6.1.3 Example of Angle Data Conversion for more information. \"
-    result = (static_cast<double>(angle) 
-            / static_cast<double>(std::pow(2, 14))) 
-            * static_cast<double>(90); // Convert 2's complement to degrees. 
+    result = static_cast<double>(angle) 
+           * ANGLE_DEGREES_PER_LSB; // Convert 2's complement to degrees. 
            
     return result;    
 }
 
-double NuerteySCL3300Device::ConvertTemperature(const int16_t& temperature) const
+template <SPITransport Transport_t, ModePolicy Mode_t>
+double NuerteySCL3300Device<Transport_t, Mode_t>::ConvertTemperature(const int16_t& temperature) const
 {
     double result{0.0};
     
@@ -1391,8 +3157,9 @@ double NuerteySCL3300Device::ConvertTemperature(const int16_t& temperature) cons
     return result;
 }
 
+template <SPITransport Transport_t, ModePolicy Mode_t>
 template<typename T>
-double NuerteySCL3300Device::ConvertTemperature(const int16_t& temperature) const
+double NuerteySCL3300Device<Transport_t, Mode_t>::ConvertTemperature(const int16_t& temperature) const
 {
     static_assert((std::is_same_v<T, Celsius_t>
                 || std::is_same_v<T, Fahrenheit_t>
@@ -1422,63 +3189,16 @@ double NuerteySCL3300Device::ConvertTemperature(const int16_t& temperature) cons
     return result;    
 }
 
-std::error_code NuerteySCL3300Device::ConvertStatusSummaryToErrorCode(
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ConvertStatusSummaryToErrorCode(
                                            const uint16_t& status) const
 {
-    std::error_code result{};
-               
-    // Consider the presence of status register errors in order of my 
-    // own inferred logical priority. It is also assumed that these 
-    // errors are either-or.
-    if (status & 0x0001)
-    {
-        result = make_error_code(SensorStatus_t::ERROR_STATUS_REGISTER_PIN_CONTINUITY);
-    }
-    else if (status & 0x0002)
-    {
-        result = make_error_code(SensorStatus_t::ERROR_STATUS_REGISTER_MODE_CHANGED);
-    }
-    else if (status & 0x0004)
-    {
-        result = make_error_code(SensorStatus_t::ERROR_STATUS_REGISTER_DEVICE_POWERED_DOWN);
-    }
-    else if (status & 0x0008)
-    {
-        result = make_error_code(SensorStatus_t::ERROR_STATUS_REGISTER_NON_VOLATILE_MEMORY_ERRORED);
-    }
-    else if (status & 0x0010)
-    {
-        result = make_error_code(SensorStatus_t::ERROR_STATUS_REGISTER_SAFE_VOLTAGE_LEVELS_EXCEEDED);
-    }
-    else if (status & 0x0020)
-    {
-        result = make_error_code(SensorStatus_t::ERROR_STATUS_REGISTER_TEMPERATURE_SIGNAL_PATH_SATURATED);
-    }
-    else if (status & 0x0040)
-    {
-        result = make_error_code(SensorStatus_t::ERROR_STATUS_REGISTER_ACCELERATION_SIGNAL_PATH_SATURATED);
-    }
-    else if (status & 0x0080)
-    {
-        result = make_error_code(SensorStatus_t::ERROR_STATUS_REGISTER_CLOCK_ERRORED);
-    }
-    else if (status & 0x0100)
-    {
-        result = make_error_code(SensorStatus_t::ERROR_STATUS_REGISTER_DIGITAL_BLOCK_ERRORED_TYPE_2);
-    }
-    else if (status & 0x0200)
-    {
-        result = make_error_code(SensorStatus_t::ERROR_STATUS_REGISTER_DIGITAL_BLOCK_ERRORED_TYPE_1);
-    }
-    else
-    {
-        result = make_error_code(SensorStatus_t::SUCCESS);
-    }    
-    
-    return result;
+    // Constant time; the lowest set bit being the highest priority.
+    return make_error_code(ToSensorStatus(DecodeStatusSummary(status)));
 }
 
-std::error_code NuerteySCL3300Device::ConvertSTOToErrorCode(
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ConvertSTOToErrorCode(
                                                const int16_t& sto) const
 {   
     // \" Table 23 Examples for STO Thresholds
@@ -1494,80 +3214,20 @@ std::error_code NuerteySCL3300Device::ConvertSTOToErrorCode(
 
     std::error_code result{};
     
-    if (OperationMode_t::MODE_1 == m_InclinometerMode)
-    { 
-        if ((sto < -1800) || (sto > 1800))
-        {
-            result = make_error_code(SensorStatus_t::ERROR_STO_SIGNAL_EXCEEDS_THRESHOLD);
-        }
-    }
-    else if (OperationMode_t::MODE_2 == m_InclinometerMode)
-    {
-        if ((sto < -900) || (sto > 900))
-        {
-            result = make_error_code(SensorStatus_t::ERROR_STO_SIGNAL_EXCEEDS_THRESHOLD);
-        }
-    }
-    else if ((OperationMode_t::MODE_3 == m_InclinometerMode)
-          || (OperationMode_t::MODE_4 == m_InclinometerMode))
+    const auto threshold = GetModeProfile().m_STOThreshold;
+    
+    if ((sto < -threshold) || (sto > threshold))
     {
-        if ((sto < -3600) || (sto > 3600))
-        {
-            result = make_error_code(SensorStatus_t::ERROR_STO_SIGNAL_EXCEEDS_THRESHOLD);
-        }
+        result = make_error_code(SensorStatus_t::ERROR_STO_SIGNAL_EXCEEDS_THRESHOLD);
     }
     
     return result;
 }
 
-ErrorFlag1Reason_t NuerteySCL3300Device::ConvertErrorFlag1ToReason(const uint16_t& errorFlag) const
-{
-    ErrorFlag1Reason_t result = ErrorFlag1Reason_t::SUCCESS_NO_ERROR;
-               
-    // Consider the presence of register errors in order of my own 
-    // inferred logical priority. It is also assumed that these errors
-    // are either-or.
-    auto errorFlagBits = SixteenBits_t{errorFlag};
-
-    // Traverse in order of inferred logical priority.
-    for (std::size_t position = 0; position < errorFlagBits.size(); position++)
-    {
-        if (errorFlagBits.test(position))
-        {
-            result = ToEnum<ErrorFlag1Reason_t, uint16_t>(
-                         static_cast<uint16_t>(std::pow(2, position)));
-            break;
-        }
-    }
-        
-    return result;   
-}
-
-ErrorFlag2Reason_t NuerteySCL3300Device::ConvertErrorFlag2ToReason(const uint16_t& errorFlag) const
-{
-    ErrorFlag2Reason_t result = ErrorFlag2Reason_t::SUCCESS_NO_ERROR;
-               
-    // Consider the presence of register errors in order of my own 
-    // inferred logical priority. It is also assumed that these errors
-    // are either-or.
-    auto errorFlagBits = SixteenBits_t{errorFlag};
-
-    // Traverse in order of inferred logical priority.
-    for (std::size_t position = 0; position < errorFlagBits.size(); position++)
-    {
-        if (errorFlagBits.test(position))
-        {
-            result = ToEnum<ErrorFlag2Reason_t, uint16_t>(
-                         static_cast<uint16_t>(std::pow(2, position)));
-            break;
-        }
-    }
-        
-    return result;      
-}
-
-std::string NuerteySCL3300Device::ComposeSerialNumber(const uint16_t& serial1LSB, 
-                                                      const uint16_t& serial2MSB) const
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::ComposeSerialNumber(const uint16_t& serial1LSB, 
+                                                      const uint16_t& serial2MSB,
+                                                      SerialNumber_t& serialNumber) const
 {
     // \" Serial Block contains sensor serial number in two 16 bit 
     // registers in register bank #1, see 6.5 CMD for information how to
@@ -1586,29 +3246,35 @@ std::string NuerteySCL3300Device::ComposeSerialNumber(const uint16_t& serial1LSB
     //     3. Add letters “B33” to end \"
     
     uint32_t tempValue = static_cast<uint32_t>(serial2MSB << 16) | static_cast<uint32_t>(serial1LSB);
-    auto result = std::to_string(tempValue) + std::string("B33");
 
-    return result;
+    const auto digits = Formatting::FormatInteger(serialNumber, tempValue);
+    std::copy(SERIAL_NUMBER_SUFFIX.begin(), SERIAL_NUMBER_SUFFIX.end(), 
+              serialNumber.begin() + digits.size());
+    serialNumber[digits.size() + SERIAL_NUMBER_SUFFIX.size()] = '\0';
 } 
 
-double NuerteySCL3300Device::GetAccelerationXAxis() const
+template <SPITransport Transport_t, ModePolicy Mode_t>
+double NuerteySCL3300Device<Transport_t, Mode_t>::GetAccelerationXAxis() const
 {
-    return ConvertAcceleration(std::get<2>(std::get<0>(g_TheSensorData)));
+    return ConvertAcceleration(m_LatestSample.Get(Channel_t::ACCELERATION_X_AXIS));
 }
 
-double NuerteySCL3300Device::GetAccelerationYAxis() const
+template <SPITransport Transport_t, ModePolicy Mode_t>
+double NuerteySCL3300Device<Transport_t, Mode_t>::GetAccelerationYAxis() const
 {
-    return ConvertAcceleration(std::get<2>(std::get<1>(g_TheSensorData)));
+    return ConvertAcceleration(m_LatestSample.Get(Channel_t::ACCELERATION_Y_AXIS));
 }
 
-double NuerteySCL3300Device::GetAccelerationZAxis() const
+template <SPITransport Transport_t, ModePolicy Mode_t>
+double NuerteySCL3300Device<Transport_t, Mode_t>::GetAccelerationZAxis() const
 {
-    return ConvertAcceleration(std::get<2>(std::get<2>(g_TheSensorData)));
+    return ConvertAcceleration(m_LatestSample.Get(Channel_t::ACCELERATION_Z_AXIS));
 }
 
-double NuerteySCL3300Device::GetAngleXAxis() const
+template <SPITransport Transport_t, ModePolicy Mode_t>
+double NuerteySCL3300Device<Transport_t, Mode_t>::GetAngleXAxis() const
 {
-    auto result = ConvertAngle(std::get<2>(std::get<5>(g_TheSensorData)));
+    auto result = ConvertAngle(m_LatestSample.Get(Channel_t::ANGLE_X_AXIS));
     
     // Present negative angle in its corresponding positive form. As is
     // obvious, when an angle is -360°, it implies that we have made
@@ -1616,9 +3282,10 @@ double NuerteySCL3300Device::GetAngleXAxis() const
     return ((result < 0) ? (result + static_cast<double>(360)) : result);
 }
 
-double NuerteySCL3300Device::GetAngleYAxis() const
+template <SPITransport Transport_t, ModePolicy Mode_t>
+double NuerteySCL3300Device<Transport_t, Mode_t>::GetAngleYAxis() const
 {
-    auto result = ConvertAngle(std::get<2>(std::get<6>(g_TheSensorData)));
+    auto result = ConvertAngle(m_LatestSample.Get(Channel_t::ANGLE_Y_AXIS));
     
     // Present negative angle in its corresponding positive form. As is
     // obvious, when an angle is -360°, it implies that we have made
@@ -1626,9 +3293,10 @@ double NuerteySCL3300Device::GetAngleYAxis() const
     return ((result < 0) ? (result + static_cast<double>(360)) : result);
 }
 
-double NuerteySCL3300Device::GetAngleZAxis() const
+template <SPITransport Transport_t, ModePolicy Mode_t>
+double NuerteySCL3300Device<Transport_t, Mode_t>::GetAngleZAxis() const
 {
-    auto result = ConvertAngle(std::get<2>(std::get<7>(g_TheSensorData)));
+    auto result = ConvertAngle(m_LatestSample.Get(Channel_t::ANGLE_Z_AXIS));
     
     // Present negative angle in its corresponding positive form. As is
     // obvious, when an angle is -360°, it implies that we have made
@@ -1636,8 +3304,9 @@ double NuerteySCL3300Device::GetAngleZAxis() const
     return ((result < 0) ? (result + static_cast<double>(360)) : result);
 }
     
+template <SPITransport Transport_t, ModePolicy Mode_t>
 template<typename T>
-double NuerteySCL3300Device::GetTemperature() const
+double NuerteySCL3300Device<Transport_t, Mode_t>::GetTemperature() const
 {
     static_assert((std::is_same_v<T, Celsius_t>
                 || std::is_same_v<T, Fahrenheit_t>
@@ -1645,50 +3314,92 @@ double NuerteySCL3300Device::GetTemperature() const
     "Hey! Temperature scale MUST be one of the following types: \
                 \n\tCelsius_t\n\tFahrenheit_t \n\tKelvin_t");
                     
-    return ConvertTemperature<T>(std::get<2>(std::get<4>(g_TheSensorData)));
+    return ConvertTemperature<T>(m_LatestSample.Get(Channel_t::TEMPERATURE));
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+FixedPointSample_t NuerteySCL3300Device<Transport_t, Mode_t>::ConvertToFixedPoint(
+                                           const SCL3300Sample_t& sample) const
+{
+    FixedPointSample_t result{};
+    const auto& factors = GetModeProfile().m_ScaleFactors;
+
+    result.m_AccelerationMilliG = {
+        ToMilliG(sample.Get(Channel_t::ACCELERATION_X_AXIS), factors),
+        ToMilliG(sample.Get(Channel_t::ACCELERATION_Y_AXIS), factors),
+        ToMilliG(sample.Get(Channel_t::ACCELERATION_Z_AXIS), factors)};
+
+    result.m_AngleCentiDegrees = {
+        ToCentiDegrees(sample.Get(Channel_t::ANGLE_X_AXIS)),
+        ToCentiDegrees(sample.Get(Channel_t::ANGLE_Y_AXIS)),
+        ToCentiDegrees(sample.Get(Channel_t::ANGLE_Z_AXIS))};
+
+    result.m_TemperatureCentiCelsius = ToCentiCelsius(sample.Get(Channel_t::TEMPERATURE));
+    result.m_SequenceNumber          = sample.m_SequenceNumber;
+    result.m_Timestamp               = sample.m_Timestamp;
+
+    return result;
 }
 
-std::error_code NuerteySCL3300Device::GetSelfTestOutputErrorCode() const
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::GetSelfTestOutputErrorCode() const
 {   
     // \" Self-test reading in 2's complement format \": 
-    auto result = std::get<2>(std::get<3>(g_TheSensorData));
+    auto result = m_LatestSample.Get(Channel_t::SELF_TEST_OUTPUT);
     
     return ConvertSTOToErrorCode(result);
 }
 
-std::error_code NuerteySCL3300Device::GetStatusSummaryErrorCode() const
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::GetStatusSummaryErrorCode() const
 {
     // Status Summary combining ERR_FLAG1 and ERR_FLAG2.
-    auto result = std::get<2>(std::get<8>(g_TheSensorData));
+    auto result = m_LatestSample.GetUnsigned(Channel_t::STATUS_SUMMARY);
     
     return ConvertStatusSummaryToErrorCode(result);
 }
 
+template <SPITransport Transport_t, ModePolicy Mode_t>
+StatusFlagSet_t NuerteySCL3300Device<Transport_t, Mode_t>::GetStatusSummaryFlags() const
+{
+    return DecodeStatusSummary(m_LatestSample.GetUnsigned(Channel_t::STATUS_SUMMARY));
+}
+
 // C++20 concepts:    
+template <SPITransport Transport_t, ModePolicy Mode_t>
 template <typename E>
     requires (std::is_same_v<E, ErrorFlag1Reason_t> || std::is_same_v<E, ErrorFlag2Reason_t>)
-void NuerteySCL3300Device::PrintErrorFlagReason(const uint16_t& errorFlag,
-                                                const E& reason) const
+void NuerteySCL3300Device<Transport_t, Mode_t>::PrintErrorFlagReasons(const uint16_t& errorFlag,
+                                                 const FlagSet_t<E>& reasons) const
 {
-    // Consider the presence of command register values in order of my own 
-    // inferred logical priority. It is also assumed that these values
-    // are either-or.
-    auto valueBits = SixteenBits_t{errorFlag};
+    // Every flagged reason is printed; faults frequently come in groups,
+    // e.g. a supply voltage error along with the analog power errors.
+    Formatting::TextBuffer_t<> buffer;
 
-    std::ostringstream oss;
-    oss << "\tError Flag Bit Value Received From SCL3300 Sensor: " 
-        << valueBits << "\n\n";  
+    printf("\tError Flag Bit Value Received From SCL3300 Sensor: %s\n\n", 
+        Formatting::FormatBinary(buffer, errorFlag).data());
 
-    auto convertedValue = ToUnderlyingType(reason); 
-    oss << "\t\t [" << convertedValue << "] => " 
-        << SixteenBits_t{convertedValue} << "\n\t\t "  
-        << ToString(reason).c_str() << "\n"; 
-    
-    printf("%s\n", oss.str().c_str());
+    if (reasons.IsEmpty())
+    {
+        printf("\t\t %s\n\n", ToString(E::SUCCESS_NO_ERROR).data());
+        return;
+    }
+
+    for (const auto& reason : reasons)
+    {
+        auto convertedValue = ToUnderlyingType(reason); 
+        printf("\t\t [%u] => %s\n\t\t %s\n", 
+            static_cast<unsigned>(convertedValue),
+            Formatting::FormatBinary(buffer, convertedValue).data(),
+            ToString(reason).data());
+    }
+
+    printf("\n");
 }
 
-std::error_code NuerteySCL3300Device::ReadErrorFlag1Reason(uint16_t& errorFlag, 
-                                                           ErrorFlag1Reason_t& reason)
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ReadErrorFlag1Reasons(uint16_t& errorFlag, 
+                                                            ErrorFlag1Set_t& reasons)
 {
     // STATUS register contains combination of the information in the 
     // ERR_FLAG1 and ERR_FLAG2 registers; if there is an error, it is
@@ -1697,8 +3408,8 @@ std::error_code NuerteySCL3300Device::ReadErrorFlag1Reason(uint16_t& errorFlag,
     // does not reset error flags in STATUS register nor reset RS bits.
     
     // Safety check.
-    AssertValidSPICommandFrame<SPICommandFrame_t>(SWITCH_TO_BANK_0);
-    AssertValidSPICommandFrame<SPICommandFrame_t>(READ_ERROR_FLAG_1);
+    AssertValidSPICommandFrame<SWITCH_TO_BANK_0>();
+    AssertValidSPICommandFrame<READ_ERROR_FLAG_1>();
     
     std::error_code result{};
     
@@ -1713,7 +3424,7 @@ std::error_code NuerteySCL3300Device::ReadErrorFlag1Reason(uint16_t& errorFlag,
     // recommended to keep memory bank #0 selected unless register from
     // bank #1 is required, for example, reading serial number of sensor.
     // After using bank #1 user should switch back to bank #0. \"
-    result = FullDuplexTransfer(SWITCH_TO_BANK_0, response);
+    result = SelectBank(SWITCH_TO_BANK_0, response);
     
     if (!result)
     {
@@ -1738,38 +3449,39 @@ std::error_code NuerteySCL3300Device::ReadErrorFlag1Reason(uint16_t& errorFlag,
                         __PRETTY_FUNCTION__,
                         result.value());
                             
-                    reason = ConvertErrorFlag1ToReason(errorFlag);
-                    PrintErrorFlagReason<ErrorFlag1Reason_t>(errorFlag, reason);               
+                    reasons = DecodeErrorFlag1(errorFlag);
+                    PrintErrorFlagReasons(errorFlag, reasons);
                 }
                 else
                 {
                     printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                              result.value(), result.message().c_str());
+                              result.value(), GetErrorMessage(result));
                 }
             }
             else
             {
                 printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                          result.value(), result.message().c_str());
+                          result.value(), GetErrorMessage(result));
             }
         }
         else
         {
             printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                      result.value(), result.message().c_str());
+                      result.value(), GetErrorMessage(result));
         }
     }
     else
     {
         printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                  result.value(), result.message().c_str());
+                  result.value(), GetErrorMessage(result));
     }
         
     return result;
 }
 
-std::error_code NuerteySCL3300Device::ReadErrorFlag2Reason(uint16_t& errorFlag, 
-                                                           ErrorFlag2Reason_t& reason)
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ReadErrorFlag2Reasons(uint16_t& errorFlag, 
+                                                            ErrorFlag2Set_t& reasons)
 {
     // STATUS register contains combination of the information in the 
     // ERR_FLAG1 and ERR_FLAG2 registers; if there is an error, it is
@@ -1778,8 +3490,8 @@ std::error_code NuerteySCL3300Device::ReadErrorFlag2Reason(uint16_t& errorFlag,
     // does not reset error flags in STATUS register nor reset RS bits.
     
     // Safety check.
-    AssertValidSPICommandFrame<SPICommandFrame_t>(SWITCH_TO_BANK_0);
-    AssertValidSPICommandFrame<SPICommandFrame_t>(READ_ERROR_FLAG_2);
+    AssertValidSPICommandFrame<SWITCH_TO_BANK_0>();
+    AssertValidSPICommandFrame<READ_ERROR_FLAG_2>();
     
     std::error_code result{};
     
@@ -1794,7 +3506,7 @@ std::error_code NuerteySCL3300Device::ReadErrorFlag2Reason(uint16_t& errorFlag,
     // recommended to keep memory bank #0 selected unless register from
     // bank #1 is required, for example, reading serial number of sensor.
     // After using bank #1 user should switch back to bank #0. \"
-    result = FullDuplexTransfer(SWITCH_TO_BANK_0, response);
+    result = SelectBank(SWITCH_TO_BANK_0, response);
     if (!result)
     {
         // Ignore first SPI response per off-frame protocol note above.
@@ -1818,37 +3530,54 @@ std::error_code NuerteySCL3300Device::ReadErrorFlag2Reason(uint16_t& errorFlag,
                         __PRETTY_FUNCTION__,
                         result.value());
                             
-                    reason = ConvertErrorFlag2ToReason(errorFlag);  
-                    PrintErrorFlagReason<ErrorFlag2Reason_t>(errorFlag, reason);             
+                    reasons = DecodeErrorFlag2(errorFlag);
+                    PrintErrorFlagReasons(errorFlag, reasons);             
                 }
                 else
                 {
                     printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                              result.value(), result.message().c_str());
+                              result.value(), GetErrorMessage(result));
                 }
             }
             else
             {
                 printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                          result.value(), result.message().c_str());
+                          result.value(), GetErrorMessage(result));
             }
         }
         else
         {
             printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                      result.value(), result.message().c_str());
+                      result.value(), GetErrorMessage(result));
         }
     }
     else
     {
         printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                  result.value(), result.message().c_str());
+                  result.value(), GetErrorMessage(result));
     }
         
     return result;
 }
 
-std::error_code NuerteySCL3300Device::ReadSerialNumber(std::string& serialNumber)
+#if !defined(SCL3300_ZERO_HEAP)
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ReadSerialNumber(std::string& serialNumber)
+{
+    SerialNumber_t buffer{};
+
+    auto result = ReadSerialNumber(buffer);
+    if (!result)
+    {
+        serialNumber = buffer.data();
+    }
+
+    return result;
+}
+#endif
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ReadSerialNumber(SerialNumber_t& serialNumber)
 {
     // \" Serial Block contains sensor serial number in two 16 bit 
     // registers in register bank #1, see 6.5 CMD for information how to
@@ -1867,10 +3596,10 @@ std::error_code NuerteySCL3300Device::ReadSerialNumber(std::string& serialNumber
     //     3. Add letters “B33” to end \"
     
     // Safety check.
-    AssertValidSPICommandFrame<SPICommandFrame_t>(SWITCH_TO_BANK_1);
-    AssertValidSPICommandFrame<SPICommandFrame_t>(READ_SERIAL_1);
-    AssertValidSPICommandFrame<SPICommandFrame_t>(READ_SERIAL_2);
-    AssertValidSPICommandFrame<SPICommandFrame_t>(SWITCH_TO_BANK_0);
+    AssertValidSPICommandFrame<SWITCH_TO_BANK_1>();
+    AssertValidSPICommandFrame<READ_SERIAL_1>();
+    AssertValidSPICommandFrame<READ_SERIAL_2>();
+    AssertValidSPICommandFrame<SWITCH_TO_BANK_0>();
     
     std::error_code result{};
     
@@ -1885,7 +3614,7 @@ std::error_code NuerteySCL3300Device::ReadSerialNumber(std::string& serialNumber
     // recommended to keep memory bank #0 selected unless register from
     // bank #1 is required, for example, reading serial number of sensor.
     // After using bank #1 user should switch back to bank #0. \"
-    result = FullDuplexTransfer(SWITCH_TO_BANK_1, response);
+    result = SelectBank(SWITCH_TO_BANK_1, response);
     if (!result)
     {
         // Ignore first SPI response per off-frame protocol note above.
@@ -1907,11 +3636,6 @@ std::error_code NuerteySCL3300Device::ReadSerialNumber(std::string& serialNumber
                         
                 if (!result)
                 {
-                    printf("Success! %s: \n\t[%d] -> Successfully received"
-                        " contents of SERIAL1 register.\n", 
-                        __PRETTY_FUNCTION__,
-                        result.value());
-                           
                     // \" SELBANK - Switch between active register banks
                     //
                     // SELBANK is used to switch between memory banks #0 and #1. It’s 
@@ -1929,51 +3653,42 @@ std::error_code NuerteySCL3300Device::ReadSerialNumber(std::string& serialNumber
                                 
                         if (!result)
                         {
-                            serialNumber = ComposeSerialNumber(serial1LSB, serial2MSB);
+                            ComposeSerialNumber(serial1LSB, serial2MSB, serialNumber);
                             
-                            printf("Success! %s: \n\t[%d] -> Successfully received"
-                                " contents of SERIAL2 register.\n\tSerial Number = %s\n", 
-                                __PRETTY_FUNCTION__,
-                                result.value(), serialNumber.c_str());           
+                            m_EventLog.template Record<DriverEvent_t::SERIAL_NUMBER_READ>(serial2MSB, serial1LSB);
                         }
                         else
                         {
-                            printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                                      result.value(), result.message().c_str());
+                            m_EventLog.template Record<DriverEvent_t::SERIAL_NUMBER_READ_FAILED>(result.value());
                         }
                     }
                     else
                     {
-                        printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                                  result.value(), result.message().c_str());
+                        m_EventLog.template Record<DriverEvent_t::SERIAL_NUMBER_READ_FAILED>(result.value());
                     }
                 }
                 else
                 {
-                    printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                              result.value(), result.message().c_str());
+                    m_EventLog.template Record<DriverEvent_t::SERIAL_NUMBER_READ_FAILED>(result.value());
                 }
             }
             else
             {
-                printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                          result.value(), result.message().c_str());
+                m_EventLog.template Record<DriverEvent_t::SERIAL_NUMBER_READ_FAILED>(result.value());
             }
         }
         else
         {
-            printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                      result.value(), result.message().c_str());
+            m_EventLog.template Record<DriverEvent_t::SERIAL_NUMBER_READ_FAILED>(result.value());
         }
     }
     else
     {
-        printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                  result.value(), result.message().c_str());
+        m_EventLog.template Record<DriverEvent_t::SERIAL_NUMBER_READ_FAILED>(result.value());
     }
        
-    // In case we fell into any of the else error cases above. Force a 
-    // switch back to bank 0 anyway:
+    // In case we fell into any of the else error cases above. Ensure a 
+    // switch back to bank 0 anyway (a no-op when already there):
     
     // \" SELBANK - Switch between active register banks
     //
@@ -1981,17 +3696,16 @@ std::error_code NuerteySCL3300Device::ReadSerialNumber(std::string& serialNumber
     // recommended to keep memory bank #0 selected unless register from
     // bank #1 is required, for example, reading serial number of sensor.
     // After using bank #1 user should switch back to bank #0. \"
-    FullDuplexTransfer(SWITCH_TO_BANK_0, response);
+    SelectBank(SWITCH_TO_BANK_0, response);
      
     return result;
 }
 
-std::error_code NuerteySCL3300Device::ReadCurrentBank(MemoryBank_t& bank)
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ReadCurrentBank(MemoryBank_t& bank)
 {    
     // Safety check.
-    AssertValidSPICommandFrame<SPICommandFrame_t>(SWITCH_TO_BANK_1);
-    AssertValidSPICommandFrame<SPICommandFrame_t>(READ_CURRENT_BANK);
-    AssertValidSPICommandFrame<SPICommandFrame_t>(SWITCH_TO_BANK_0);
+    AssertValidSPICommandFrame<READ_CURRENT_BANK>();
     
     std::error_code result{};
     
@@ -2000,92 +3714,76 @@ std::error_code NuerteySCL3300Device::ReadCurrentBank(MemoryBank_t& bank)
     // not applicable... \"
     SPICommandFrame_t response = {}; // Initialize to zeros.
     
-    // \" SELBANK - Switch between active register banks
-    //
-    // SELBANK is used to switch between memory banks #0 and #1. It’s 
-    // recommended to keep memory bank #0 selected unless register from
-    // bank #1 is required, for example, reading serial number of sensor.
-    // After using bank #1 user should switch back to bank #0. \"
-    result = FullDuplexTransfer(SWITCH_TO_BANK_1, response);
+    // SELBANK is accessible from either memory bank. Hence read it in
+    // place, without switching banks, so as to report the bank that is
+    // truly active. The result also resynchronizes our bank shadow.
+    result = FullDuplexTransfer(READ_CURRENT_BANK, response);
     if (!result)
     {
         // Ignore first SPI response per off-frame protocol note above.
         result = FullDuplexTransfer(READ_CURRENT_BANK, response);
-        
         if (!result)
-        {
-            result = FullDuplexTransfer(SWITCH_TO_BANK_0, response);
+        {   
+            uint16_t bankNumber = 0;
+            
+            // What is the type of the sensor data in this particular case? 
+            result = ValidateSPIResponseFrame<uint16_t>(
+                    bankNumber, 
+                    READ_CURRENT_BANK, 
+                    response);
+                    
             if (!result)
-            {   
-                uint16_t bankNumber = 0;
+            {
+                bank = ToEnum<MemoryBank_t, uint16_t>(bankNumber);
+                m_ActiveBank = bank;
                 
-                // What is the type of the sensor data in this particular case? 
-                result = ValidateSPIResponseFrame<uint16_t>(
-                        bankNumber, 
-                        READ_CURRENT_BANK, 
-                        response);
-                        
-                if (!result)
-                {
-                    bank = ToEnum<MemoryBank_t, uint16_t>(bankNumber);
-                    
-                    printf("Success! %s: \n\t[%d] -> Successfully read"
-                        " current bank register. \n\t%d\n", 
-                        __PRETTY_FUNCTION__,
-                        result.value(), bankNumber);
-                }
-                else
-                {
-                    printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                              result.value(), result.message().c_str());
-                }
+                printf("Success! %s: \n\t[%d] -> Successfully read"
+                    " current bank register. \n\t%d\n", 
+                    __PRETTY_FUNCTION__,
+                    result.value(), bankNumber);
             }
             else
             {
                 printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                          result.value(), result.message().c_str());
+                          result.value(), GetErrorMessage(result));
             }
         }
         else
         {
             printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                      result.value(), result.message().c_str());
+                      result.value(), GetErrorMessage(result));
         }
     }
     else
     {
         printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                  result.value(), result.message().c_str());
+                  result.value(), GetErrorMessage(result));
     }
-       
-    // In case we fell into any of the else error cases above. Force a 
-    // switch back to bank 0 anyway:
-    
-    // \" SELBANK - Switch between active register banks
-    //
-    // SELBANK is used to switch between memory banks #0 and #1. It’s 
-    // recommended to keep memory bank #0 selected unless register from
-    // bank #1 is required, for example, reading serial number of sensor.
-    // After using bank #1 user should switch back to bank #0. \"
-    FullDuplexTransfer(SWITCH_TO_BANK_0, response);
      
     return result;       
 }
 
+template <SPITransport Transport_t, ModePolicy Mode_t>
 template <SPICommandFrame_t V>
-std::error_code NuerteySCL3300Device::SwitchToBank()
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::SwitchToBank()
 {
     static_assert(((V == SWITCH_TO_BANK_0) || (V == SWITCH_TO_BANK_1)),
         "Hey! SPI Command Frame MUST be one of the following: \
          \n\tSWITCH_TO_BANK_0 \n\tSWITCH_TO_BANK_1");
     
     // Safety check.
-    AssertValidSPICommandFrame<SPICommandFrame_t>(SWITCH_TO_BANK_1);
-    AssertValidSPICommandFrame<SPICommandFrame_t>(V);
-    AssertValidSPICommandFrame<SPICommandFrame_t>(SWITCH_TO_BANK_0);
+    AssertValidSPICommandFrame<V>();
+    AssertValidSPICommandFrame<READ_CURRENT_BANK>();
     
     std::error_code result{};
     
+    // Nothing to transmit when the requested bank is already active.
+    if (IsBankActive(V))
+    {
+        ++m_BankSwitchesAvoided;
+        return result;
+    }
+    
     // \" ... Due to off-frame protocol of SPI the first response to 
     // MOSI command is a response to earlier MOSI command and is thus
     // not applicable... \"
@@ -2097,117 +3795,92 @@ std::error_code NuerteySCL3300Device::SwitchToBank()
     // recommended to keep memory bank #0 selected unless register from
     // bank #1 is required, for example, reading serial number of sensor.
     // After using bank #1 user should switch back to bank #0. \"
-    result = FullDuplexTransfer(SWITCH_TO_BANK_1, response); // The Switch Bank commands themselves are in bank 1.
+    //
+    // SELBANK is accessible from either bank, so switch directly. It is
+    // then up to the caller to return to bank #0 when done with bank #1.
+    result = FullDuplexTransfer(V, response);
     if (!result)
     {
-        // Ignore first SPI response per off-frame protocol note above.
-        result = FullDuplexTransfer(V, response);
-        
+        // Collect the response to the SELBANK write per off-frame protocol.
+        result = FullDuplexTransfer(READ_CURRENT_BANK, response);
         if (!result)
-        {
-            result = FullDuplexTransfer(SWITCH_TO_BANK_0, response);
+        {   
+            uint16_t bankNumber = 0;
+            
+            // What is the type of the sensor data in this particular case? 
+            result = ValidateSPIResponseFrame<uint16_t>(
+                    bankNumber, 
+                    V, 
+                    response);
+                    
             if (!result)
-            {   
-                uint16_t bankNumber = 0;
-                
-                // What is the type of the sensor data in this particular case? 
-                result = ValidateSPIResponseFrame<uint16_t>(
-                        bankNumber, 
-                        V, 
-                        response);
-                        
-                if (!result)
-                {
-                    printf("Success! %s: \n\t[%d] -> Successfully switched"
-                        " the current memory bank register. \n\t%d\n", 
-                        __PRETTY_FUNCTION__,
-                        result.value(), bankNumber);
-                }
-                else
-                {
-                    printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                              result.value(), result.message().c_str());
-                }
+            {
+                printf("Success! %s: \n\t[%d] -> Successfully switched"
+                    " the current memory bank register. \n\t%d\n", 
+                    __PRETTY_FUNCTION__,
+                    result.value(), bankNumber);
             }
             else
             {
                 printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                          result.value(), result.message().c_str());
+                          result.value(), GetErrorMessage(result));
             }
         }
         else
         {
             printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                      result.value(), result.message().c_str());
+                      result.value(), GetErrorMessage(result));
         }
     }
     else
     {
         printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                  result.value(), result.message().c_str());
+                  result.value(), GetErrorMessage(result));
     }
-       
-    // In case we fell into any of the else error cases above. Force a 
-    // switch back to bank 0 anyway:
-    
-    // \" SELBANK - Switch between active register banks
-    //
-    // SELBANK is used to switch between memory banks #0 and #1. It’s 
-    // recommended to keep memory bank #0 selected unless register from
-    // bank #1 is required, for example, reading serial number of sensor.
-    // After using bank #1 user should switch back to bank #0. \"
-    FullDuplexTransfer(SWITCH_TO_BANK_0, response);
      
     return result;
 }
 
-void NuerteySCL3300Device::SwitchToBank0()
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::SwitchToBank0()
 {
     SwitchToBank<SWITCH_TO_BANK_0>();    
 }
 
-void NuerteySCL3300Device::SwitchToBank1()
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::SwitchToBank1()
 {
     SwitchToBank<SWITCH_TO_BANK_1>();    
 }
 
-void NuerteySCL3300Device::PrintCommandRegisterValues(const uint16_t& commandValue) const
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::PrintCommandRegisterValues(const uint16_t& commandValue) const
 {
-    // Consider the presence of command register values in order of my own 
-    // inferred logical priority. It is also assumed that these values
-    // are and'ed.
-    auto valueBits = SixteenBits_t{commandValue};
+    // The operation mode field, i.e. bits [1:0], is printed first and
+    // then every other set bit stacked up beneath it.
+    Formatting::TextBuffer_t<> buffer;
 
-    std::ostringstream oss;
-    oss << "\tCommand Response Value: " << valueBits << "\n\n";  
+    printf("\tCommand Response Value: %s\n\n", 
+        Formatting::FormatBinary(buffer, commandValue).data());
 
-    if (commandValue == 0) // Degenerate case of Operation Mode 1.
-    {
-        auto result = ToEnum<CommandRegisterValue_t, uint16_t>(commandValue);
-        oss << "\t\t [" << commandValue << "] " 
-            << ToString(result).c_str() << "\n";  
-    }
+    const auto [mode, flags] = DecodeCommandRegister(commandValue);
+
+    printf("\t\t [%u] %s\n", static_cast<unsigned>(ToUnderlyingType(mode)), ToString(mode).data());
 
-    // Traverse map and print out the presence of all valid command register
-    // values. Implication is, no 'break' in the for-loop as in error flags.
-    for (const auto& [key, value] : gs_CommandRegisterValueMap)
+    for (const auto& flag : flags)
     {
-        if (ToUnderlyingType(key) & commandValue)
-        {
-            // The intention is to print out all the descriptions stacked up.
-            oss << "\t\t [" << ToUnderlyingType(key) << "] " 
-                << value.c_str() << "\n"; 
-        }
+        printf("\t\t [%u] %s\n", static_cast<unsigned>(ToUnderlyingType(flag)), ToString(flag).data());
     }
     
-    printf("%s\n", oss.str().c_str());
+    printf("\n");
 }
 
-std::error_code NuerteySCL3300Device::ReadCommandRegister(SixteenBits_t& bitValue)
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ReadCommandRegister(SixteenBits_t& bitValue)
 {
     // Safety check.
-    AssertValidSPICommandFrame<SPICommandFrame_t>(SWITCH_TO_BANK_0);
-    AssertValidSPICommandFrame<SPICommandFrame_t>(READ_COMMAND);
+    AssertValidSPICommandFrame<SWITCH_TO_BANK_0>();
+    AssertValidSPICommandFrame<READ_COMMAND>();
     
     std::error_code result{};
     
@@ -2222,7 +3895,7 @@ std::error_code NuerteySCL3300Device::ReadCommandRegister(SixteenBits_t& bitValu
     // recommended to keep memory bank #0 selected unless register from
     // bank #1 is required, for example, reading serial number of sensor.
     // After using bank #1 user should switch back to bank #0. \"
-    result = FullDuplexTransfer(SWITCH_TO_BANK_0, response);
+    result = SelectBank(SWITCH_TO_BANK_0, response);
     if (!result)
     {
         // Ignore first SPI response per off-frame protocol note above.
@@ -2255,32 +3928,33 @@ std::error_code NuerteySCL3300Device::ReadCommandRegister(SixteenBits_t& bitValu
                 else
                 {
                     printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                              result.value(), result.message().c_str());
+                              result.value(), GetErrorMessage(result));
                 }
             }
             else
             {
                 printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                          result.value(), result.message().c_str());
+                          result.value(), GetErrorMessage(result));
             }
         }
         else
         {
             printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                      result.value(), result.message().c_str());
+                      result.value(), GetErrorMessage(result));
         }
     }
     else
     {
         printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                  result.value(), result.message().c_str());
+                  result.value(), GetErrorMessage(result));
     }
        
     return result;    
 }
 
+template <SPITransport Transport_t, ModePolicy Mode_t>
 template <SPICommandFrame_t V>
-std::error_code NuerteySCL3300Device::WriteCommandOperation()
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::WriteCommandOperation()
 {
     // \" Sets operation mode, SW Reset and Power down mode. \"
     
@@ -2309,10 +3983,13 @@ std::error_code NuerteySCL3300Device::WriteCommandOperation()
          \n\tSOFTWARE_RESET");
     
     // Safety check.
-    AssertValidSPICommandFrame<SPICommandFrame_t>(SWITCH_TO_BANK_0);
-    AssertValidSPICommandFrame<SPICommandFrame_t>(V);
-    AssertValidSPICommandFrame<SPICommandFrame_t>(READ_COMMAND);
+    AssertValidSPICommandFrame<SWITCH_TO_BANK_0>();
+    AssertValidSPICommandFrame<V>();
+    AssertValidSPICommandFrame<READ_COMMAND>();
     
+    // The value written to the MODE register; for the event log.
+    constexpr int32_t COMMAND = ((V[1] << 8) | V[2]);
+
     std::error_code result{};
     
     // \" ... Due to off-frame protocol of SPI the first response to 
@@ -2326,7 +4003,7 @@ std::error_code NuerteySCL3300Device::WriteCommandOperation()
     // recommended to keep memory bank #0 selected unless register from
     // bank #1 is required, for example, reading serial number of sensor.
     // After using bank #1 user should switch back to bank #0. \"
-    result = FullDuplexTransfer(SWITCH_TO_BANK_0, response);
+    result = SelectBank(SWITCH_TO_BANK_0, response);
     if (!result)
     {
         // Ignore first SPI response per off-frame protocol note above.
@@ -2344,44 +4021,48 @@ std::error_code NuerteySCL3300Device::WriteCommandOperation()
                         commandValue, 
                         V, 
                         response);
+
+                // As quoted above, all but the software reset flag the
+                // Status Summary, and hence RS bits '11' are then to be 
+                // expected rather than indicative of an invalid frame.
+                if constexpr (V != SOFTWARE_RESET)
+                {
+                    if (result.value() == ToUnderlyingType(SensorStatus_t::ERROR_INVALID_COMMAND_FRAME))
+                    {
+                        result       = std::error_code{};
+                        commandValue = std::get<3>(Deserialize<uint16_t>(response));
+                    }
+                }
                         
                 if (!result)
                 {
-                    printf("Success! %s: \n\t[%d] -> Successfully wrote"
-                        " command operation to the SCL3300 sensor.\n", 
-                        __PRETTY_FUNCTION__,
-                        result.value());
-                        
-                    PrintCommandRegisterValues(commandValue);
+                    m_EventLog.template Record<DriverEvent_t::COMMAND_WRITTEN>(COMMAND, commandValue);
                 }
                 else
                 {
-                    printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                              result.value(), result.message().c_str());
+                    m_EventLog.template Record<DriverEvent_t::COMMAND_WRITE_FAILED>(result.value(), COMMAND);
                 }
             }
             else
             {
-                printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                          result.value(), result.message().c_str());
+                m_EventLog.template Record<DriverEvent_t::COMMAND_WRITE_FAILED>(result.value(), COMMAND);
             }
         }
         else
         {
-            printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                      result.value(), result.message().c_str());
+            m_EventLog.template Record<DriverEvent_t::COMMAND_WRITE_FAILED>(result.value(), COMMAND);
         }
     }
     else
     {
-        printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                  result.value(), result.message().c_str());
+        m_EventLog.template Record<DriverEvent_t::COMMAND_WRITE_FAILED>(result.value(), COMMAND);
     }
      
     return result;
 }
 
-std::error_code NuerteySCL3300Device::EnableAngleOutputs()
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::EnableAngleOutputs()
 {
     // \" Angle outputs must be enabled before angles can be read from
     // registers. See section 6.6 for details. \"
@@ -2391,8 +4072,8 @@ std::error_code NuerteySCL3300Device::EnableAngleOutputs()
     // 1Fh to ANG_CTRL. \"
 
     // Safety check.
-    AssertValidSPICommandFrame<SPICommandFrame_t>(SWITCH_TO_BANK_0);
-    AssertValidSPICommandFrame<SPICommandFrame_t>(ENABLE_ANGLE_OUTPUTS);
+    AssertValidSPICommandFrame<SWITCH_TO_BANK_0>();
+    AssertValidSPICommandFrame<ENABLE_ANGLE_OUTPUTS>();
     
     std::error_code result{};
     
@@ -2407,7 +4088,7 @@ std::error_code NuerteySCL3300Device::EnableAngleOutputs()
     // recommended to keep memory bank #0 selected unless register from
     // bank #1 is required, for example, reading serial number of sensor.
     // After using bank #1 user should switch back to bank #0. \"
-    result = FullDuplexTransfer(SWITCH_TO_BANK_0, response);
+    result = SelectBank(SWITCH_TO_BANK_0, response);
     if (!result)
     {
         // Ignore first SPI response per off-frame protocol note above.
@@ -2428,39 +4109,33 @@ std::error_code NuerteySCL3300Device::EnableAngleOutputs()
                         
                 if (!result)
                 {
-                    printf("Success! %s: \n\t[%d] -> Successfully wrote"
-                        " ENABLE_ANGLE_OUTPUTS to the SCL3300 sensor.\n", 
-                        __PRETTY_FUNCTION__,
-                        result.value());
+                    m_EventLog.template Record<DriverEvent_t::ANGLE_OUTPUTS_ENABLED>(registerValue);
                 }
                 else
                 {
-                    printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                              result.value(), result.message().c_str());
+                    m_EventLog.template Record<DriverEvent_t::ANGLE_OUTPUTS_ENABLE_FAILED>(result.value());
                 }
             }
             else
             {
-                printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                          result.value(), result.message().c_str());
+                m_EventLog.template Record<DriverEvent_t::ANGLE_OUTPUTS_ENABLE_FAILED>(result.value());
             }
         }
         else
         {
-            printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                      result.value(), result.message().c_str());
+            m_EventLog.template Record<DriverEvent_t::ANGLE_OUTPUTS_ENABLE_FAILED>(result.value());
         }
     }
     else
     {
-        printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
-                  result.value(), result.message().c_str());
+        m_EventLog.template Record<DriverEvent_t::ANGLE_OUTPUTS_ENABLE_FAILED>(result.value());
     }
      
     return result;
 }
 
-void NuerteySCL3300Device::InitiateResetIfErrorCode(const std::error_code& errorCode)
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::InitiateResetIfErrorCode(const std::error_code& errorCode)
 {
     if (errorCode)
     {
@@ -2478,16 +4153,19 @@ void NuerteySCL3300Device::InitiateResetIfErrorCode(const std::error_code& error
     }
 }
 
-void NuerteySCL3300Device::InitiateResetIfErrorFlag2(const ErrorFlag2Reason_t& reason)
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::InitiateResetIfErrorFlag2(const ErrorFlag2Set_t& reasons)
 {
-    if (ToUnderlyingType(reason) == ToUnderlyingType(ErrorFlag2Reason_t::DPWR))
+    // Regardless of whatever else may be flagged alongside.
+    if (reasons.Contains(ErrorFlag2Reason_t::DPWR))
     {
         // Error Flag 2 Register value is instructing that "SW or HW reset needed".
         SoftwareReset(); 
     }       
 }
 
-void NuerteySCL3300Device::ChangeToMode1()
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ChangeToMode1() requires (IsModeChangeAllowed<Mode_t, OperationMode_t::MODE_1>())
 {
     // \" Sets operation mode, SW Reset and Power down mode. \"
     
@@ -2504,17 +4182,21 @@ void NuerteySCL3300Device::ChangeToMode1()
     // Status Summary bit 2 to high (see 6.3.) Thus RS bits will show
     // ‘11’ (see 5.1.5.). Note: User must not configure other than given
     // valid commands, otherwise power-off, reset, or power down is required. \"
-    printf("Changing the Operation Mode of the SCL3300 sensor to MODE_1...\n");
-    m_InclinometerMode = OperationMode_t::MODE_1;    
-    auto result = WriteCommandOperation<CHANGE_TO_MODE_1>();    
+    //
+    // Should the write fail, the mode the sensor is in is unknown; it is
+    // for the caller to reset the sensor, e.g. as part of its recovery.
+    const auto result = WriteCommandOperation<CHANGE_TO_MODE_1>();
     
-    if (result)
+    if (!result)
     {
-        SoftwareReset();
+        SetInclinometerMode(OperationMode_t::MODE_1);
     }
+    
+    return result;
 }
 
-void NuerteySCL3300Device::ChangeToMode2()
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ChangeToMode2() requires (IsModeChangeAllowed<Mode_t, OperationMode_t::MODE_2>())
 {
     // \" Sets operation mode, SW Reset and Power down mode. \"
     
@@ -2531,17 +4213,21 @@ void NuerteySCL3300Device::ChangeToMode2()
     // Status Summary bit 2 to high (see 6.3.) Thus RS bits will show
     // ‘11’ (see 5.1.5.). Note: User must not configure other than given
     // valid commands, otherwise power-off, reset, or power down is required. \"
-    printf("Changing the Operation Mode of the SCL3300 sensor to MODE_2...\n");
-    m_InclinometerMode = OperationMode_t::MODE_2;
-    auto result = WriteCommandOperation<CHANGE_TO_MODE_2>();    
+    //
+    // Should the write fail, the mode the sensor is in is unknown; it is
+    // for the caller to reset the sensor, e.g. as part of its recovery.
+    const auto result = WriteCommandOperation<CHANGE_TO_MODE_2>();
     
-    if (result)
+    if (!result)
     {
-        SoftwareReset();
+        SetInclinometerMode(OperationMode_t::MODE_2);
     }
+    
+    return result;
 }
 
-void NuerteySCL3300Device::ChangeToMode3()
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ChangeToMode3() requires (IsModeChangeAllowed<Mode_t, OperationMode_t::MODE_3>())
 {
     // \" Sets operation mode, SW Reset and Power down mode. \"
     
@@ -2558,17 +4244,21 @@ void NuerteySCL3300Device::ChangeToMode3()
     // Status Summary bit 2 to high (see 6.3.) Thus RS bits will show
     // ‘11’ (see 5.1.5.). Note: User must not configure other than given
     // valid commands, otherwise power-off, reset, or power down is required. \"
-    printf("Changing the Operation Mode of the SCL3300 sensor to MODE_3...\n");    
-    m_InclinometerMode = OperationMode_t::MODE_3;
-    auto result = WriteCommandOperation<CHANGE_TO_MODE_3>();    
+    //
+    // Should the write fail, the mode the sensor is in is unknown; it is
+    // for the caller to reset the sensor, e.g. as part of its recovery.
+    const auto result = WriteCommandOperation<CHANGE_TO_MODE_3>();
     
-    if (result)
+    if (!result)
     {
-        SoftwareReset();
+        SetInclinometerMode(OperationMode_t::MODE_3);
     }
+    
+    return result;
 }
 
-void NuerteySCL3300Device::ChangeToMode4()
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ChangeToMode4() requires (IsModeChangeAllowed<Mode_t, OperationMode_t::MODE_4>())
 {
     // \" Sets operation mode, SW Reset and Power down mode. \"
     
@@ -2585,49 +4275,89 @@ void NuerteySCL3300Device::ChangeToMode4()
     // Status Summary bit 2 to high (see 6.3.) Thus RS bits will show
     // ‘11’ (see 5.1.5.). Note: User must not configure other than given
     // valid commands, otherwise power-off, reset, or power down is required. \"
-    printf("Changing the Operation Mode of the SCL3300 sensor to MODE_4...\n");
-    m_InclinometerMode = OperationMode_t::MODE_4;
-    auto result = WriteCommandOperation<CHANGE_TO_MODE_4>();    
+    //
+    // Should the write fail, the mode the sensor is in is unknown; it is
+    // for the caller to reset the sensor, e.g. as part of its recovery.
+    const auto result = WriteCommandOperation<CHANGE_TO_MODE_4>();
     
-    if (result)
+    if (!result)
     {
-        SoftwareReset();
+        SetInclinometerMode(OperationMode_t::MODE_4);
+    }
+    
+    return result;
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::SetInclinometerMode(const OperationMode_t& mode)
+{
+    m_InclinometerMode = mode;
+    m_ModeProfile      = &MODE_PROFILES[ToUnderlyingType(mode)];
+}
+
+template <SPITransport Transport_t, ModePolicy Mode_t>
+std::error_code NuerteySCL3300Device<Transport_t, Mode_t>::ChangeToFixedMode() requires (Mode_t::IS_FIXED)
+{
+    if constexpr (Mode_t::MODE == OperationMode_t::MODE_1)
+    {
+        return ChangeToMode1();
+    }
+    else if constexpr (Mode_t::MODE == OperationMode_t::MODE_2)
+    {
+        return ChangeToMode2();
+    }
+    else if constexpr (Mode_t::MODE == OperationMode_t::MODE_3)
+    {
+        return ChangeToMode3();
+    }
+    else
+    {
+        return ChangeToMode4();
     }
 }
 
-void NuerteySCL3300Device::PowerDown()
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::PowerDown()
 {
     // In order to save power, instruct the sensor into a Powered Down mode.
-    printf("Powering down the SCL3300 sensor in order to save power...\n");
-    m_PoweredDownMode = true;
+    m_PoweredDownMode     = true;
+    m_StartupInProgress   = false; // Any start-up is abandoned.
+    m_AwaitingFirstSample = false;
     WriteCommandOperation<SET_POWERDOWN_MODE>();    
 }
 
-void NuerteySCL3300Device::WakeupFromPowerDown()
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::WakeupFromPowerDown()
 {
-    printf("Waking up the SCL3300 sensor from PowerDown mode...\n");
+    BeginStartupTiming();
     m_PoweredDownMode = false;
     WriteCommandOperation<WAKEUP_FROM_POWERDOWN_MODE>();    
 }
 
-void NuerteySCL3300Device::SoftwareReset()
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::SoftwareReset()
 {
     // \"Software (SW) reset is done with SPI operation (see 5.1.4). 
     // Hardware (HW) reset is done by power cycling the sensor. If these
     // do not reset the error, then possible component error has occurred
     // and system needs to be shut down and part returned to supplier. \"
-    printf("Software resetting the SCL3300 sensor...\n");
+    BeginStartupTiming();
     WriteCommandOperation<SOFTWARE_RESET>();
+    
+    // \" Power-cycle, reset and power down mode will reset all written
+    // settings. \" That is, the sensor reverts to its default Mode 1.
+    SetInclinometerMode(OperationMode_t::MODE_1);
 }
 
-void NuerteySCL3300Device::AssertWhoAmI() const
+template <SPITransport Transport_t, ModePolicy Mode_t>
+void NuerteySCL3300Device<Transport_t, Mode_t>::AssertWhoAmI() const
 { 
     // \" WHOAMI is a 8-bit register for component identification. 
     // Returned value is C1h.
     //
     // Note: as returned value is fixed, this can be used to ensure SPI
     // communication is working correctly. \"
-    uint8_t retrievedValue = (std::get<2>(std::get<9>(g_TheSensorData)) & 0xFF);
+    uint8_t retrievedValue = (m_LatestSample.GetUnsigned(Channel_t::WHO_AM_I) & 0xFF);
     
     assert(((void)"WHOAMI component identification incorrect! SPI \
                    communication must NOT be working correctly!", 
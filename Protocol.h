@@ -47,6 +47,7 @@
 #include <cstddef>
 #include <cassert>
 #include <type_traits>
+#include <string_view>
 
 #include "Utilities.h"
 
@@ -69,6 +70,11 @@ using SPIMISOFrame_t    = std::tuple<uint8_t,  // Operation Code, Read/Write
                                      T,        // Sensor Data
                                      uint8_t>; // Checksum
 
+// A register read request, i.e. the SELBANK frame which makes the
+// register accessible paired with the read command frame itself:
+using RegisterRead_t    = std::pair<SPICommandFrame_t,  // SWITCH_TO_BANK_0/SWITCH_TO_BANK_1
+                                    SPICommandFrame_t>; // Read command
+
 namespace ProtocolDefinitions
 {
     enum class OperationCodeRW_t : uint8_t
@@ -98,7 +104,7 @@ namespace ProtocolDefinitions
         // \" Error flag (or flags) are active in Status Summary register, 
         // or previous MOSI-command had incorrect frame CRC. \" 
         //
-        // The provision of AssertValidSPICommandFrame<T>() far below is 
+        // The provision of AssertValidSPICommandFrame<V>() far below is 
         // to ensure that the above "or" last point CANNOT occur. Hence 
         // leaving us with only "Flags Active in Status Summary Register"
         // as the only viable occurrence. 
@@ -127,111 +133,17 @@ namespace ProtocolDefinitions
     // more inclusive by instantiating what the older standard allows.
 
     // \" 3. Add letters “B33” to end \"
-    //constexpr std::string  SERIAL_NUMBER_SUFFIX{"B33"};
+    constexpr std::string_view SERIAL_NUMBER_SUFFIX{"B33"};
+
+    // Up to 10 decimal digits of the 32-bit serial, the suffix and a NUL.
+    using SerialNumber_t = std::array<char, 10 + SERIAL_NUMBER_SUFFIX.size() + 1>;
     
     constexpr SPICommandFrame_t RETURN_STATUS_MASK{0x03, 0x00, 0x00, 0x00};
     
-    // =================================================================
-    // /" Table 14 Operations And Their Equivalent SPI Frames /"
-    //
-    // Note that other than these below, no other command frame values
-    // are allowed. 
-    // =================================================================
-    
-    // Pertaining to the SPI CRC on the MOSI line, note that these SPI
-    // command frames specified below have already had a precomputed CRC
-    // byte appended. It is indeed the last byte, SPI [7:0] (MSB first).
-    //
-    // SPI Frame Specification Detail:
-    //
-    // \" OP (RW + ADDR)[31:26] + RS[25:24] + DATA[23:8] + CRC[7:0] \"
-    constexpr SPICommandFrame_t READ_ACCELERATION_X_AXIS  {0x04, 0x00, 0x00, 0xF7};
-    constexpr SPICommandFrame_t READ_ACCELERATION_Y_AXIS  {0x08, 0x00, 0x00, 0xFD};
-    constexpr SPICommandFrame_t READ_ACCELERATION_Z_AXIS  {0x0C, 0x00, 0x00, 0xFB};
-    constexpr SPICommandFrame_t READ_SELF_TEST_OUTPUT     {0x10, 0x00, 0x00, 0xE9};
-    constexpr SPICommandFrame_t ENABLE_ANGLE_OUTPUTS      {0xB0, 0x00, 0x1F, 0x6F};
-    constexpr SPICommandFrame_t READ_ANGLE_X_AXIS         {0x24, 0x00, 0x00, 0xC7};
-    constexpr SPICommandFrame_t READ_ANGLE_Y_AXIS         {0x28, 0x00, 0x00, 0xCD};
-    constexpr SPICommandFrame_t READ_ANGLE_Z_AXIS         {0x2C, 0x00, 0x00, 0xCB};
-    constexpr SPICommandFrame_t READ_TEMPERATURE          {0x14, 0x00, 0x00, 0xEF};
-    constexpr SPICommandFrame_t READ_STATUS_SUMMARY       {0x18, 0x00, 0x00, 0xE5};
-    constexpr SPICommandFrame_t READ_ERROR_FLAG_1         {0x1C, 0x00, 0x00, 0xE3};
-    constexpr SPICommandFrame_t READ_ERROR_FLAG_2         {0x20, 0x00, 0x00, 0xC1};
-    constexpr SPICommandFrame_t READ_COMMAND              {0x34, 0x00, 0x00, 0xDF};
-    constexpr SPICommandFrame_t CHANGE_TO_MODE_1          {0xB4, 0x00, 0x00, 0x1F};
-    constexpr SPICommandFrame_t CHANGE_TO_MODE_2          {0xB4, 0x00, 0x01, 0x02};
-    constexpr SPICommandFrame_t CHANGE_TO_MODE_3          {0xB4, 0x00, 0x02, 0x25};
-    constexpr SPICommandFrame_t CHANGE_TO_MODE_4          {0xB4, 0x00, 0x03, 0x38};
-    constexpr SPICommandFrame_t SET_POWERDOWN_MODE        {0xB4, 0x00, 0x04, 0x6B};
-    constexpr SPICommandFrame_t WAKEUP_FROM_POWERDOWN_MODE{0xB4, 0x00, 0x00, 0x1F};
-    constexpr SPICommandFrame_t SOFTWARE_RESET            {0xB4, 0x00, 0x20, 0x98};
-    constexpr SPICommandFrame_t READ_WHO_AM_I             {0x40, 0x00, 0x00, 0x91};
-    constexpr SPICommandFrame_t READ_SERIAL_1             {0x64, 0x00, 0x00, 0xA7};
-    constexpr SPICommandFrame_t READ_SERIAL_2             {0x68, 0x00, 0x00, 0xAD};
-    constexpr SPICommandFrame_t READ_CURRENT_BANK         {0x7C, 0x00, 0x00, 0xB3};
-    constexpr SPICommandFrame_t SWITCH_TO_BANK_0          {0xFC, 0x00, 0x00, 0x73};
-    constexpr SPICommandFrame_t SWITCH_TO_BANK_1          {0xFC, 0x00, 0x01, 0x6E};
-
-    inline void DisplayFrame(const SPICommandFrame_t& frame)
-    {
-        if (!frame.empty())
-        {
-            std::ostringstream oss;
-
-            oss << "\n\t0x";
-            for (auto& byte : frame)
-            {
-                oss << std::setfill('0') << std::setw(2) << std::hex 
-                    << std::uppercase << static_cast<unsigned>(byte);
-            }
-            oss << '\n';
-            
-            printf("%s\n", oss.str().c_str());
-        }
-    }
-
-    template <typename T>
-    inline void AssertValidSPICommandFrame(const T& frame)
-    {
-        static_assert((std::is_same_v<T, SPICommandFrame_t>),
-            "Hey! Frame argument MUST be of type: SPICommandFrame_t");
-                    
-        if ((READ_ACCELERATION_X_AXIS   != frame)
-         && (READ_ACCELERATION_Y_AXIS   != frame)
-         && (READ_ACCELERATION_Z_AXIS   != frame)
-         && (READ_SELF_TEST_OUTPUT      != frame)
-         && (ENABLE_ANGLE_OUTPUTS       != frame)
-         && (READ_ANGLE_X_AXIS          != frame)
-         && (READ_ANGLE_Y_AXIS          != frame)
-         && (READ_ANGLE_Z_AXIS          != frame)
-         && (READ_TEMPERATURE           != frame)
-         && (READ_STATUS_SUMMARY        != frame)
-         && (READ_ERROR_FLAG_1          != frame)
-         && (READ_ERROR_FLAG_2          != frame)
-         && (READ_COMMAND               != frame)
-         && (CHANGE_TO_MODE_1           != frame)
-         && (CHANGE_TO_MODE_2           != frame)
-         && (CHANGE_TO_MODE_3           != frame)
-         && (CHANGE_TO_MODE_4           != frame)
-         && (SET_POWERDOWN_MODE         != frame)
-         && (WAKEUP_FROM_POWERDOWN_MODE != frame)
-         && (SOFTWARE_RESET             != frame)
-         && (READ_WHO_AM_I              != frame)
-         && (READ_SERIAL_1              != frame)
-         && (READ_SERIAL_2              != frame)
-         && (READ_CURRENT_BANK          != frame)
-         && (SWITCH_TO_BANK_0           != frame)
-         && (SWITCH_TO_BANK_1           != frame))
-        {
-            DisplayFrame(frame);
-            assert(((void)"This SPI Command Frame is NOT valid/allowed!", (false)));
-        }
-    }
-    
     // Copied verbatim from 'datasheet_scl3300-d01.pdf':
     //
     // https://www.murata.com/-/media/webrenewal/products/sensor/pdf/datasheet/datasheet_scl3300-d01.ashx?la=en-sg
-    inline uint8_t CalculateCRC(uint8_t BitValue, uint8_t eightCRC)
+    constexpr uint8_t CalculateCRC(uint8_t BitValue, uint8_t eightCRC)
     {
         uint8_t Temp;
         Temp = static_cast<uint8_t>(eightCRC & 0x80);
@@ -250,7 +162,7 @@ namespace ProtocolDefinitions
     // Copied verbatim from 'datasheet_scl3300-d01.pdf':
     //
     // https://www.murata.com/-/media/webrenewal/products/sensor/pdf/datasheet/datasheet_scl3300-d01.ashx?la=en-sg
-    inline uint8_t CalculateCRC(uint32_t frame)
+    constexpr uint8_t CalculateCRC(uint32_t frame)
     {
         // Calculate CRC for 24 MSB's of the 32 bit dword
         // (8 LSB's are the CRC field and are not included in CRC calculation)
@@ -269,15 +181,453 @@ namespace ProtocolDefinitions
         return eightCRC;
     }
     
-    inline uint8_t CalculateCRC(const SPICommandFrame_t& frame)
+    // The datasheet's bit-serial routine as applied to a whole frame. 
+    // Retained as the reference against which the table-driven engine
+    // below is verified (and benchmarked).
+    constexpr uint8_t CalculateCRCBitwise(const SPICommandFrame_t& frame)
     {
-        uint32_t theFlatFrame = (frame.at(0) << 24) 
-                              + (frame.at(1) << 16)
-                              + (frame.at(2) << 8) 
+        uint32_t theFlatFrame = (static_cast<uint32_t>(frame.at(0)) << 24) 
+                              + (static_cast<uint32_t>(frame.at(1)) << 16)
+                              + (static_cast<uint32_t>(frame.at(2)) << 8) 
                               + frame.at(3);
                               
         return CalculateCRC(theFlatFrame);
     }
+
+    // \" Table 16 SPI CRC definition
+    //
+    // CRC-8
+    // Polynomial: X8+X4+X3+X2+1
+    // Seed: 0xFF \"
+    constexpr uint8_t CRC_POLYNOMIAL{0x1D};
+    constexpr uint8_t CRC_SEED{0xFF};
+
+    // Advances 'eightCRC' over the 'numberOfBits' most significant bits
+    // of 'value', MSB first, exactly as the bit-serial routine above does.
+    constexpr uint8_t AdvanceCRC(uint8_t eightCRC, const uint8_t& value, const uint8_t& numberOfBits)
+    {
+        eightCRC ^= value;
+        for (uint8_t bit = 0; bit < numberOfBits; ++bit)
+        {
+            eightCRC = static_cast<uint8_t>((eightCRC & 0x80) 
+                                          ? ((eightCRC << 1) ^ CRC_POLYNOMIAL) 
+                                          : (eightCRC << 1));
+        }
+        return eightCRC;
+    }
+
+#if defined(SCL3300_CRC_NIBBLE_TABLE)
+    // 16 bytes of flash rather than 256, at the cost of two lookups per byte.
+    constexpr auto CRC_NIBBLE_TABLE = []()
+    {
+        std::array<uint8_t, 16> table{};
+        for (std::size_t index = 0; index < table.size(); ++index)
+        {
+            table[index] = AdvanceCRC(0, static_cast<uint8_t>(index << 4), 4);
+        }
+        return table;
+    }();
+
+    constexpr uint8_t UpdateCRC(const uint8_t& eightCRC, const uint8_t& byte)
+    {
+        auto result = static_cast<uint8_t>((eightCRC << 4) 
+                    ^ CRC_NIBBLE_TABLE[(eightCRC ^ byte) >> 4]);
+        result = static_cast<uint8_t>((result << 4) 
+               ^ CRC_NIBBLE_TABLE[static_cast<uint8_t>(result ^ (byte << 4)) >> 4]);
+        return result;
+    }
+#else
+    constexpr auto CRC_TABLE = []()
+    {
+        std::array<uint8_t, 256> table{};
+        for (std::size_t index = 0; index < table.size(); ++index)
+        {
+            table[index] = AdvanceCRC(0, static_cast<uint8_t>(index), 8);
+        }
+        return table;
+    }();
+
+    constexpr uint8_t UpdateCRC(const uint8_t& eightCRC, const uint8_t& byte)
+    {
+        return CRC_TABLE[eightCRC ^ byte];
+    }
+#endif
+
+    // Table-driven CRC over the three leading bytes of the frame; i.e.
+    // \" OP (RW + ADDR)[31:26] + RS[25:24] + DATA[23:8] \". The trailing 
+    // CRC byte itself is not included in the calculation.
+    constexpr uint8_t CalculateCRC(const SPICommandFrame_t& frame)
+    {
+        uint8_t eightCRC = CRC_SEED;
+        eightCRC = UpdateCRC(eightCRC, frame[0]);
+        eightCRC = UpdateCRC(eightCRC, frame[1]);
+        eightCRC = UpdateCRC(eightCRC, frame[2]);
+        
+        return static_cast<uint8_t>(~eightCRC);
+    }
+
+    // \" Table 18 Register address space \"
+    enum class RegisterAddress_t : uint8_t
+    {
+        ACC_X     = 0x01,
+        ACC_Y     = 0x02,
+        ACC_Z     = 0x03,
+        STO       = 0x04,
+        TEMP      = 0x05,
+        STATUS    = 0x06,
+        ERR_FLAG1 = 0x07,
+        ERR_FLAG2 = 0x08,
+        ANG_X     = 0x09,
+        ANG_Y     = 0x0A,
+        ANG_Z     = 0x0B,
+        ANG_CTRL  = 0x0C,
+        MODE      = 0x0D,
+        WHOAMI    = 0x10,
+        SERIAL1   = 0x19,
+        SERIAL2   = 0x1A,
+        SELBANK   = 0x1F
+    };
+
+    // The memory bank within which a register resides. Empty for 
+    // SELBANK, which is accessible from either bank.
+    constexpr std::optional<MemoryBank_t> GetRegisterBank(const RegisterAddress_t& address)
+    {
+        if (RegisterAddress_t::SELBANK == address)
+        {
+            return std::nullopt;
+        }
+        else if ((RegisterAddress_t::SERIAL1 == address)
+              || (RegisterAddress_t::SERIAL2 == address))
+        {
+            return MemoryBank_t::BANK_1;
+        }
+        return MemoryBank_t::BANK_0;
+    }
+
+    // Compile-time description of an SPI command; i.e. everything that
+    // goes into a MOSI frame, save for the CRC which is derived. The bank
+    // is not part of the frame; see MakeRegisterRead().
+    struct CommandDescriptor_t
+    {
+        OperationCodeRW_t                m_ReadWrite;
+        RegisterAddress_t                m_Address;
+        uint16_t                         m_Data;
+    };
+
+    constexpr SPICommandFrame_t MakeSPICommandFrame(const CommandDescriptor_t& command)
+    {
+        SPICommandFrame_t frame{static_cast<uint8_t>((Utilities::ToUnderlyingType(command.m_ReadWrite) << 7)
+                                                   | (Utilities::ToUnderlyingType(command.m_Address) << 2)),
+                                static_cast<uint8_t>(command.m_Data >> 8),
+                                static_cast<uint8_t>(command.m_Data & 0xFF),
+                                0x00};
+        frame[3] = CalculateCRC(frame);
+        
+        return frame;
+    }
+
+    constexpr SPICommandFrame_t MakeReadFrame(const RegisterAddress_t& address)
+    {
+        return MakeSPICommandFrame({OperationCodeRW_t::READ, address, 0x0000});
+    }
+
+    constexpr SPICommandFrame_t MakeWriteFrame(const RegisterAddress_t& address,
+                                               const uint16_t& data)
+    {
+        return MakeSPICommandFrame({OperationCodeRW_t::WRITE, address, data});
+    }
+
+    // =================================================================
+    // /" Table 14 Operations And Their Equivalent SPI Frames /"
+    //
+    // Note that other than these below, no other command frame values
+    // are allowed. 
+    // =================================================================
+    
+    // Pertaining to the SPI CRC on the MOSI line, note that these SPI
+    // command frames are generated, CRC byte included, at compile time
+    // from their register description. The CRC is indeed the last byte,
+    // SPI [7:0] (MSB first). See the Table 14 assertions further below.
+    //
+    // SPI Frame Specification Detail:
+    //
+    // \" OP (RW + ADDR)[31:26] + RS[25:24] + DATA[23:8] + CRC[7:0] \"
+    constexpr SPICommandFrame_t READ_ACCELERATION_X_AXIS   = MakeReadFrame(RegisterAddress_t::ACC_X);
+    constexpr SPICommandFrame_t READ_ACCELERATION_Y_AXIS   = MakeReadFrame(RegisterAddress_t::ACC_Y);
+    constexpr SPICommandFrame_t READ_ACCELERATION_Z_AXIS   = MakeReadFrame(RegisterAddress_t::ACC_Z);
+    constexpr SPICommandFrame_t READ_SELF_TEST_OUTPUT      = MakeReadFrame(RegisterAddress_t::STO);
+    constexpr SPICommandFrame_t ENABLE_ANGLE_OUTPUTS       = MakeWriteFrame(RegisterAddress_t::ANG_CTRL, 0x001F);
+    constexpr SPICommandFrame_t READ_ANGLE_X_AXIS          = MakeReadFrame(RegisterAddress_t::ANG_X);
+    constexpr SPICommandFrame_t READ_ANGLE_Y_AXIS          = MakeReadFrame(RegisterAddress_t::ANG_Y);
+    constexpr SPICommandFrame_t READ_ANGLE_Z_AXIS          = MakeReadFrame(RegisterAddress_t::ANG_Z);
+    constexpr SPICommandFrame_t READ_TEMPERATURE           = MakeReadFrame(RegisterAddress_t::TEMP);
+    constexpr SPICommandFrame_t READ_STATUS_SUMMARY        = MakeReadFrame(RegisterAddress_t::STATUS);
+    constexpr SPICommandFrame_t READ_ERROR_FLAG_1          = MakeReadFrame(RegisterAddress_t::ERR_FLAG1);
+    constexpr SPICommandFrame_t READ_ERROR_FLAG_2          = MakeReadFrame(RegisterAddress_t::ERR_FLAG2);
+    constexpr SPICommandFrame_t READ_COMMAND               = MakeReadFrame(RegisterAddress_t::MODE);
+    constexpr SPICommandFrame_t CHANGE_TO_MODE_1           = MakeWriteFrame(RegisterAddress_t::MODE, 0x0000);
+    constexpr SPICommandFrame_t CHANGE_TO_MODE_2           = MakeWriteFrame(RegisterAddress_t::MODE, 0x0001);
+    constexpr SPICommandFrame_t CHANGE_TO_MODE_3           = MakeWriteFrame(RegisterAddress_t::MODE, 0x0002);
+    constexpr SPICommandFrame_t CHANGE_TO_MODE_4           = MakeWriteFrame(RegisterAddress_t::MODE, 0x0003);
+    constexpr SPICommandFrame_t SET_POWERDOWN_MODE         = MakeWriteFrame(RegisterAddress_t::MODE, 0x0004);
+    constexpr SPICommandFrame_t WAKEUP_FROM_POWERDOWN_MODE = MakeWriteFrame(RegisterAddress_t::MODE, 0x0000);
+    constexpr SPICommandFrame_t SOFTWARE_RESET             = MakeWriteFrame(RegisterAddress_t::MODE, 0x0020);
+    constexpr SPICommandFrame_t READ_WHO_AM_I              = MakeReadFrame(RegisterAddress_t::WHOAMI);
+    constexpr SPICommandFrame_t READ_SERIAL_1              = MakeReadFrame(RegisterAddress_t::SERIAL1);
+    constexpr SPICommandFrame_t READ_SERIAL_2              = MakeReadFrame(RegisterAddress_t::SERIAL2);
+    constexpr SPICommandFrame_t READ_CURRENT_BANK          = MakeReadFrame(RegisterAddress_t::SELBANK);
+    constexpr SPICommandFrame_t SWITCH_TO_BANK_0           = MakeWriteFrame(RegisterAddress_t::SELBANK, 0x0000);
+    constexpr SPICommandFrame_t SWITCH_TO_BANK_1           = MakeWriteFrame(RegisterAddress_t::SELBANK, 0x0001);
+
+    // A register read, paired with the SELBANK frame which selects its
+    // bank. GetRegisterBank() is thus the one source of every bank-switch
+    // decision that ComposeFrameTrain() makes.
+    constexpr RegisterRead_t MakeRegisterRead(const RegisterAddress_t& address)
+    {
+        return {(GetRegisterBank(address) == MemoryBank_t::BANK_1) ? SWITCH_TO_BANK_1
+                                                                   : SWITCH_TO_BANK_0,
+                MakeReadFrame(address)};
+    }
+
+    // The upper bound on the number of register reads which can be
+    // batched within a single pipelined burst.
+    constexpr std::size_t MAXIMUM_PIPELINED_READS = 32;
+
+    constexpr MemoryBank_t ToMemoryBank(const SPICommandFrame_t& bankFrame)
+    {
+        return ((bankFrame == SWITCH_TO_BANK_1) ? MemoryBank_t::BANK_1
+                                                : MemoryBank_t::BANK_0);
+    }
+
+    // Builds a bank-ordered read plan. Reads are grouped by memory bank,
+    // beginning with those in the currently active bank (or bank #0 when
+    // unknown), whilst their relative order within each bank is kept.
+    //
+    // 'order' receives the indices into 'reads' in transmission order.
+    // Returns the number of SELBANK frames which the plan requires.
+    constexpr std::size_t MakeBankOrderedReadPlan(std::span<const RegisterRead_t> reads,
+                                                  const std::optional<MemoryBank_t>& activeBank,
+                                                  std::span<std::size_t> order)
+    {
+        const auto firstBank = activeBank.value_or(MemoryBank_t::BANK_0);
+
+        std::size_t position = 0;
+        for (const bool inFirstBank : {true, false})
+        {
+            for (std::size_t index = 0; index < reads.size(); ++index)
+            {
+                if ((ToMemoryBank(reads[index].first) == firstBank) == inFirstBank)
+                {
+                    order[position++] = index;
+                }
+            }
+        }
+
+        std::size_t bankSwitches = 0;
+        auto bank = activeBank;
+        for (std::size_t slot = 0; slot < reads.size(); ++slot)
+        {
+            const auto nextBank = ToMemoryBank(reads[order[slot]].first);
+            if (bank != nextBank)
+            {
+                ++bankSwitches;
+                bank = nextBank;
+            }
+        }
+
+        return bankSwitches;
+    }
+
+    // Longest possible pipelined frame train: every read, at most two
+    // SELBANK frames (by virtue of bank ordering) and the final frame
+    // which collects the last answer.
+    constexpr std::size_t MAXIMUM_FRAME_TRAIN_LENGTH = MAXIMUM_PIPELINED_READS + 3;
+
+    // Marks a frame whose response carries no answer of interest.
+    constexpr uint8_t NO_PENDING_READ = 0xFF;
+
+    // An off-frame pipelined train of SPI frames. The response to each 
+    // frame carries the answer to the read transmitted in the frame just
+    // before it. m_Answers records, per frame, the index of that read (or
+    // NO_PENDING_READ) so that trains can be validated as they complete.
+    struct FrameTrain_t
+    {
+        std::array<SPICommandFrame_t, MAXIMUM_FRAME_TRAIN_LENGTH> m_Frames{};
+        std::array<uint8_t, MAXIMUM_FRAME_TRAIN_LENGTH>           m_Answers{};
+        std::size_t                                               m_Length{0};
+        std::size_t                                               m_BankSwitchesAvoided{0};
+    };
+
+    // Composes the frame train which reads all of 'reads' given the
+    // currently active memory bank. Always concludes in bank #0.
+    constexpr FrameTrain_t ComposeFrameTrain(std::span<const RegisterRead_t> reads,
+                                             const std::optional<MemoryBank_t>& activeBank)
+    {
+        FrameTrain_t train{};
+        
+        if (reads.empty())
+        {
+            return train;
+        }
+
+        std::array<std::size_t, MAXIMUM_PIPELINED_READS> plan{};
+        auto order = std::span(plan).first(reads.size());
+        MakeBankOrderedReadPlan(reads, activeBank, order);
+
+        auto    bank        = activeBank;
+        uint8_t pendingRead = NO_PENDING_READ;
+
+        auto append = [&](const SPICommandFrame_t& frame, const uint8_t& read)
+        {
+            train.m_Frames[train.m_Length]  = frame;
+            train.m_Answers[train.m_Length] = pendingRead;
+            ++train.m_Length;
+            pendingRead = read;
+        };
+
+        for (const auto index : order)
+        {
+            const auto& [bankFrame, commandFrame] = reads[index];
+
+            if (bank == ToMemoryBank(bankFrame))
+            {
+                ++train.m_BankSwitchesAvoided;
+            }
+            else
+            {
+                append(bankFrame, NO_PENDING_READ);
+                bank = ToMemoryBank(bankFrame);
+            }
+
+            append(commandFrame, static_cast<uint8_t>(index));
+        }
+
+        // The final (N+1)th frame collects the last answer. Returning to
+        // bank #0 doubles as that frame:
+        //
+        // \" After using bank #1 user should switch back to bank #0. \"
+        append(SWITCH_TO_BANK_0, NO_PENDING_READ);
+
+        return train;
+    }
+
+    inline void DisplayFrame(const SPICommandFrame_t& frame)
+    {
+        if (!frame.empty())
+        {
+            Formatting::TextBuffer_t<> buffer;
+
+            printf("\n\t%s\n\n", Formatting::FormatHexBytes(buffer, frame).data());
+        }
+    }
+
+    
+    consteval bool HasValidCRC(const SPICommandFrame_t& frame)
+    {
+        return (CalculateCRC(frame) == frame[3])
+            && (CalculateCRCBitwise(frame) == frame[3]);
+    }
+
+    // Every byte value must agree with the datasheet's reference routine.
+    consteval bool IsCRCEngineEquivalent()
+    {
+        for (uint32_t value = 0; value <= 0xFF; ++value)
+        {
+            const SPICommandFrame_t frame{static_cast<uint8_t>(value), 
+                                          static_cast<uint8_t>(~value), 
+                                          static_cast<uint8_t>(value * 7), 
+                                          0x00};
+            if (CalculateCRC(frame) != CalculateCRCBitwise(frame))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static_assert(IsCRCEngineEquivalent(), "Hey! Table-driven CRC disagrees with the datasheet routine.");
+
+    // The generated frames must match Table 14, CRC byte and all.
+    consteval bool MatchesTable14(const SPICommandFrame_t& generated,
+                                  const SPICommandFrame_t& datasheet)
+    {
+        return (generated == datasheet) && HasValidCRC(datasheet);
+    }
+
+    static_assert(MatchesTable14(READ_ACCELERATION_X_AXIS,   {0x04, 0x00, 0x00, 0xF7}));
+    static_assert(MatchesTable14(READ_ACCELERATION_Y_AXIS,   {0x08, 0x00, 0x00, 0xFD}));
+    static_assert(MatchesTable14(READ_ACCELERATION_Z_AXIS,   {0x0C, 0x00, 0x00, 0xFB}));
+    static_assert(MatchesTable14(READ_SELF_TEST_OUTPUT,      {0x10, 0x00, 0x00, 0xE9}));
+    static_assert(MatchesTable14(ENABLE_ANGLE_OUTPUTS,       {0xB0, 0x00, 0x1F, 0x6F}));
+    static_assert(MatchesTable14(READ_ANGLE_X_AXIS,          {0x24, 0x00, 0x00, 0xC7}));
+    static_assert(MatchesTable14(READ_ANGLE_Y_AXIS,          {0x28, 0x00, 0x00, 0xCD}));
+    static_assert(MatchesTable14(READ_ANGLE_Z_AXIS,          {0x2C, 0x00, 0x00, 0xCB}));
+    static_assert(MatchesTable14(READ_TEMPERATURE,           {0x14, 0x00, 0x00, 0xEF}));
+    static_assert(MatchesTable14(READ_STATUS_SUMMARY,        {0x18, 0x00, 0x00, 0xE5}));
+    static_assert(MatchesTable14(READ_ERROR_FLAG_1,          {0x1C, 0x00, 0x00, 0xE3}));
+    static_assert(MatchesTable14(READ_ERROR_FLAG_2,          {0x20, 0x00, 0x00, 0xC1}));
+    static_assert(MatchesTable14(READ_COMMAND,               {0x34, 0x00, 0x00, 0xDF}));
+    static_assert(MatchesTable14(CHANGE_TO_MODE_1,           {0xB4, 0x00, 0x00, 0x1F}));
+    static_assert(MatchesTable14(CHANGE_TO_MODE_2,           {0xB4, 0x00, 0x01, 0x02}));
+    static_assert(MatchesTable14(CHANGE_TO_MODE_3,           {0xB4, 0x00, 0x02, 0x25}));
+    static_assert(MatchesTable14(CHANGE_TO_MODE_4,           {0xB4, 0x00, 0x03, 0x38}));
+    static_assert(MatchesTable14(SET_POWERDOWN_MODE,         {0xB4, 0x00, 0x04, 0x6B}));
+    static_assert(MatchesTable14(WAKEUP_FROM_POWERDOWN_MODE, {0xB4, 0x00, 0x00, 0x1F}));
+    static_assert(MatchesTable14(SOFTWARE_RESET,             {0xB4, 0x00, 0x20, 0x98}));
+    static_assert(MatchesTable14(READ_WHO_AM_I,              {0x40, 0x00, 0x00, 0x91}));
+    static_assert(MatchesTable14(READ_SERIAL_1,              {0x64, 0x00, 0x00, 0xA7}));
+    static_assert(MatchesTable14(READ_SERIAL_2,              {0x68, 0x00, 0x00, 0xAD}));
+    static_assert(MatchesTable14(READ_CURRENT_BANK,          {0x7C, 0x00, 0x00, 0xB3}));
+    static_assert(MatchesTable14(SWITCH_TO_BANK_0,           {0xFC, 0x00, 0x00, 0x73}));
+    static_assert(MatchesTable14(SWITCH_TO_BANK_1,           {0xFC, 0x00, 0x01, 0x6E}));
+
+    // \" Note that other than these below, no other command frame values
+    // are allowed. \"
+    constexpr std::array ALLOWED_COMMAND_FRAMES{
+        READ_ACCELERATION_X_AXIS,
+        READ_ACCELERATION_Y_AXIS,
+        READ_ACCELERATION_Z_AXIS,
+        READ_SELF_TEST_OUTPUT,
+        ENABLE_ANGLE_OUTPUTS,
+        READ_ANGLE_X_AXIS,
+        READ_ANGLE_Y_AXIS,
+        READ_ANGLE_Z_AXIS,
+        READ_TEMPERATURE,
+        READ_STATUS_SUMMARY,
+        READ_ERROR_FLAG_1,
+        READ_ERROR_FLAG_2,
+        READ_COMMAND,
+        CHANGE_TO_MODE_1,
+        CHANGE_TO_MODE_2,
+        CHANGE_TO_MODE_3,
+        CHANGE_TO_MODE_4,
+        SET_POWERDOWN_MODE,
+        WAKEUP_FROM_POWERDOWN_MODE,
+        SOFTWARE_RESET,
+        READ_WHO_AM_I,
+        READ_SERIAL_1,
+        READ_SERIAL_2,
+        READ_CURRENT_BANK,
+        SWITCH_TO_BANK_0,
+        SWITCH_TO_BANK_1};
+
+    constexpr bool IsAllowedCommandFrame(const SPICommandFrame_t& frame)
+    {
+        return std::find(ALLOWED_COMMAND_FRAMES.begin(), 
+                         ALLOWED_COMMAND_FRAMES.end(), 
+                         frame) != ALLOWED_COMMAND_FRAMES.end();
+    }
+
+    // C++20 concept over non-type template parameters: frames known at
+    // compile time are rejected at compile time, at zero runtime cost.
+    template <SPICommandFrame_t V>
+    concept ValidSPICommandFrame = IsAllowedCommandFrame(V) && (CalculateCRC(V) == V[3]);
+
+    template <SPICommandFrame_t V>
+        requires ValidSPICommandFrame<V>
+    consteval void AssertValidSPICommandFrame()
+    {
+    }
     
     inline uint8_t GetReturnStatus(const SPICommandFrame_t& frame)
     {
@@ -0,0 +1,540 @@
+/***********************************************************************
+* @file      SCL3300Simulator.h
+*
+*    Host-side simulation of the Murata Manufacturing Co. Ltd. SCL3300
+*    3-Axis Inclinometer, for regression and performance testing of the
+*    driver without hardware on the bench.
+*
+*    The simulator is an SPIResponder; i.e. it is plugged into the
+*    InMemorySPITransport of 'SPITransport.h', which in turn takes care
+*    of the off-frame delivery of its answers:
+*
+*    using SimulatedBus_t = InMemorySPITransport<SCL3300Simulator<>>;
+*    NuerteySCL3300Device<SimulatedBus_t> device(std::in_place, 0, 0, 8,
+*                                                4000000, SCL3300Simulator<>());
+*
+*    It answers exactly the frames defined in 'Protocol.h' and models the
+*    datasheet behaviour which the driver depends upon:
+*
+*     - Memory banks 0/1 and SELBANK.
+*     - The four operation modes, their sensitivities and settling times.
+*     - Return Status (RS) bits during start-up, self-test and on errors.
+*     - STATUS, ERR_FLAG1 and ERR_FLAG2 latching and clearing.
+*     - WHOAMI, SERIAL1/SERIAL2, ANG_CTRL and power down mode.
+*     - Sample-and-hold of the outputs at the sensor's output data rate.
+*
+*    Output signals are driven from scriptable waveforms (see Waveforms::
+*    below), e.g. tilt ramps, vibration and deterministic noise.
+*
+* @brief
+*
+* @note    Time is taken from Clock_t, which defaults to MonotonicClock_t.
+*          As the driver waits out its start-up delays in real time, so
+*          does the simulator settle in real time. Tests which drive the
+*          simulator directly may use VirtualClock_t instead, so that
+*          settling and inter-frame gaps become deterministic.
+*
+* @warning
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#pragma once
+
+#include <cmath>
+#include <functional>
+
+#include "SPITransport.h"
+
+namespace Simulation
+{
+    using namespace Utilities;
+    using namespace ProtocolDefinitions;
+    using namespace TransportPolicies;
+
+    // STATUS register bits, as decoded by the driver's
+    // ConvertStatusSummaryToErrorCode().
+    constexpr uint16_t STATUS_PIN_CONTINUITY = 0x0001;
+    constexpr uint16_t STATUS_MODE_CHANGED   = 0x0002;
+    constexpr uint16_t STATUS_POWERED_DOWN   = 0x0004;
+
+    // MODE (CMD) register values per Table 14.
+    constexpr uint16_t COMMAND_POWERDOWN_MODE = 0x0004;
+    constexpr uint16_t COMMAND_SOFTWARE_RESET = 0x0020;
+    constexpr uint16_t COMMAND_MODE_MASK      = 0x0003;
+
+    // Enabled angle outputs, as written by ENABLE_ANGLE_OUTPUTS.
+    constexpr uint16_t ANGLE_OUTPUTS_ENABLED  = 0x001F;
+
+    // The physical quantities the sensing element is subjected to.
+    struct Stimulus_t
+    {
+        double m_AccelerationX{0.0}; // [g]
+        double m_AccelerationY{0.0}; // [g]
+        double m_AccelerationZ{1.0}; // [g]
+        double m_Temperature{25.0};  // [°C]
+    };
+
+    // Stimulus as a function of the time elapsed since power-up.
+    using Waveform_t = std::function<Stimulus_t(const DoubleSecs_t&)>;
+
+    namespace Waveforms
+    {
+        constexpr double DEGREES_TO_RADIANS = 3.14159265358979323846 / 180.0;
+
+        // Level and at rest; i.e. +1g on Z only.
+        inline Waveform_t Level(const double& temperature = 25.0)
+        {
+            return [=](const DoubleSecs_t&)
+            {
+                return Stimulus_t{0.0, 0.0, 1.0, temperature};
+            };
+        }
+
+        // Static tilt of 'xDegrees' about Y and 'yDegrees' about X.
+        inline Waveform_t Tilt(const double& xDegrees, const double& yDegrees,
+                               const double& temperature = 25.0)
+        {
+            const auto x = xDegrees * DEGREES_TO_RADIANS;
+            const auto y = yDegrees * DEGREES_TO_RADIANS;
+
+            return [=](const DoubleSecs_t&)
+            {
+                return Stimulus_t{std::sin(x),
+                                  std::cos(x) * std::sin(y),
+                                  std::cos(x) * std::cos(y),
+                                  temperature};
+            };
+        }
+
+        // Tilts linearly from 'fromDegrees' to 'toDegrees' about Y over
+        // 'duration', holding the final angle thereafter.
+        inline Waveform_t TiltRamp(const double& fromDegrees, const double& toDegrees,
+                                   const DoubleSecs_t& duration,
+                                   const double& temperature = 25.0)
+        {
+            return [=](const DoubleSecs_t& t)
+            {
+                const auto progress = (duration.count() > 0.0)
+                                    ? std::clamp(t / duration, 0.0, 1.0) : 1.0;
+                const auto angle = (fromDegrees + (toDegrees - fromDegrees) * progress)
+                                 * DEGREES_TO_RADIANS;
+
+                return Stimulus_t{std::sin(angle), 0.0, std::cos(angle), temperature};
+            };
+        }
+
+        // Superimposes a sinusoidal vibration of 'amplitude' [g] upon Z.
+        inline Waveform_t Vibration(Waveform_t base, const double& amplitude,
+                                    const double& frequencyHz)
+        {
+            constexpr double TWO_PI = 2.0 * 3.14159265358979323846;
+
+            return [=](const DoubleSecs_t& t)
+            {
+                auto stimulus = base(t);
+                stimulus.m_AccelerationZ += amplitude * std::sin(TWO_PI * frequencyHz * t.count());
+
+                return stimulus;
+            };
+        }
+
+        // Superimposes uniformly distributed noise of +/- 'amplitude' [g]
+        // upon all axes. A fixed seed makes for reproducible regressions.
+        inline Waveform_t Noise(Waveform_t base, const double& amplitude,
+                                const uint32_t& seed = 0x5C133000)
+        {
+            return [=, state = (seed ? seed : 1u)](const DoubleSecs_t& t) mutable
+            {
+                // xorshift32
+                auto next = [&state]()
+                {
+                    state ^= state << 13;
+                    state ^= state >> 17;
+                    state ^= state << 5;
+
+                    return (static_cast<double>(state) / static_cast<double>(UINT32_MAX)) * 2.0 - 1.0;
+                };
+
+                auto stimulus = base(t);
+                stimulus.m_AccelerationX += amplitude * next();
+                stimulus.m_AccelerationY += amplitude * next();
+                stimulus.m_AccelerationZ += amplitude * next();
+
+                return stimulus;
+            };
+        }
+    } // End of namespace Waveforms.
+
+    // A clock which only moves when told to. Shared by every simulator
+    // instantiated upon it:
+    //
+    // SCL3300Simulator<VirtualClock_t> simulator;
+    // VirtualClock_t::Advance(MicroSecs_t(10));
+    struct VirtualClock_t
+    {
+        using rep        = std::int64_t;
+        using period     = std::micro;
+        using duration   = std::chrono::duration<rep, period>;
+        using time_point = std::chrono::time_point<VirtualClock_t>;
+        static constexpr bool is_steady = true;
+
+        static time_point now() noexcept { return m_Now; }
+
+        static void Advance(const duration& elapsed) { m_Now += elapsed; }
+
+    private:
+        static inline time_point m_Now{};
+    };
+
+    // Start-up and settling delays. The defaults match the waits of the
+    // driver's own start-up sequence (Table 11).
+    struct SimulatorTimings_t
+    {
+        MicroSecs_t m_ResetTime{1000};
+        MicroSecs_t m_WakeupTime{1000};
+        MicroSecs_t m_Mode1SettlingTime{25000};
+        MicroSecs_t m_Mode2SettlingTime{15000};
+        MicroSecs_t m_Mode3And4SettlingTime{100000};
+        uint32_t    m_OutputDataRateHz{2000};
+    };
+
+    template <typename Clock_t = MonotonicClock_t>
+    class SCL3300Simulator
+    {
+    public:
+        explicit SCL3300Simulator(Waveform_t waveform = Waveforms::Level(),
+                                  const SimulatorTimings_t& timings = SimulatorTimings_t(),
+                                  const uint32_t& serialNumber = 0x0012D687)
+            : m_Waveform(std::move(waveform))
+            , m_Timings(timings)
+            , m_SerialNumber(serialNumber)
+            , m_PowerUpTime(Clock_t::now())
+        {
+            Reset(m_Timings.m_ResetTime);
+        }
+
+        // Answers 'request', exactly as the sensor would in the next frame.
+        SPICommandFrame_t operator()(const SPICommandFrame_t& request)
+        {
+            const auto now = Clock_t::now();
+
+            // \" TLH Time between SPI cycles, CSB at high level (90%) 10 us \"
+            //
+            // Recorded only; in-memory transports do not honour the gap.
+            if ((m_FrameCount > 0) && ((now - m_LastFrameTime) < MicroSecs_t(10)))
+            {
+                ++m_GapViolations;
+            }
+            m_LastFrameTime = now;
+            ++m_FrameCount;
+
+            // \" In case of wrong CRC in MOSI write/read, RS bits “11” are
+            // set in the next SPI response, STATUS register is not changed,
+            // and write command must be discarded. \"
+            if (CalculateCRC(request) != request.at(3))
+            {
+                ++m_CRCErrors;
+                return MakeResponseFrame(request.at(0), ReturnStatus_t::ERROR, 0);
+            }
+
+            const bool     isWrite = (request.at(0) >> 7);
+            const auto     address = static_cast<RegisterAddress_t>((request.at(0) >> 2) & 0x1F);
+            const uint16_t data    = static_cast<uint16_t>((request.at(1) << 8) | request.at(2));
+
+            // The RS bits reflect the state prior to this very request.
+            const auto returnStatus = GetReturnStatus(now);
+
+            uint16_t value = data;
+            if (isWrite)
+            {
+                Write(address, data, now);
+            }
+            else
+            {
+                value = Read(address, now);
+            }
+
+            return MakeResponseFrame(request.at(0), returnStatus, value);
+        }
+
+        // Fault injection. Latched flags are reported by STATUS (RS '11')
+        // until read, and by ERR_FLAG1/ERR_FLAG2 until those are read.
+        void InjectFault(const uint16_t& status,
+                         const uint16_t& errorFlag1 = 0,
+                         const uint16_t& errorFlag2 = 0)
+        {
+            m_Status     |= status;
+            m_ErrorFlag1 |= errorFlag1;
+            m_ErrorFlag2 |= errorFlag2;
+        }
+
+        // Have the RS bits report '10' for 'duration' from now.
+        void BeginSelfTest(const MicroSecs_t& duration)
+        {
+            m_SelfTestEndTime = Clock_t::now() + duration;
+        }
+
+        void SetWaveform(Waveform_t waveform) { m_Waveform = std::move(waveform); m_SampleIndex = -1; }
+
+        OperationMode_t GetMode() const { return m_Mode; }
+        MemoryBank_t    GetActiveBank() const { return m_Bank; }
+        bool            IsPoweredDown() const { return m_PoweredDown; }
+        bool            AreAnglesEnabled() const { return m_AngleControl == ANGLE_OUTPUTS_ENABLED; }
+
+        uint64_t GetFrameCount() const { return m_FrameCount; }
+        uint64_t GetGapViolations() const { return m_GapViolations; }
+        uint64_t GetCRCErrors() const { return m_CRCErrors; }
+
+        // Time from power-up until the outputs were last declared valid,
+        // i.e. until start-up and settling completed.
+        MicroSecs_t GetStartupLatency() const
+        {
+            return std::chrono::duration_cast<MicroSecs_t>(m_ReadyTime - m_PowerUpTime);
+        }
+
+    protected:
+        void Reset(const MicroSecs_t& startupTime)
+        {
+            const auto now = Clock_t::now();
+
+            m_Bank         = MemoryBank_t::BANK_0;
+            m_Mode         = OperationMode_t::MODE_1;
+            m_PoweredDown  = false;
+            m_AngleControl = 0;
+            m_Status       = STATUS_MODE_CHANGED;
+            m_ErrorFlag1   = 0;
+            m_ErrorFlag2   = 0;
+            m_SampleIndex  = -1;
+
+            // Start-up only completes once the signal path of the default
+            // mode 1 has also settled; RS '00' is reported until then.
+            m_ReadyTime    = now + startupTime + m_Timings.m_Mode1SettlingTime;
+        }
+
+        void ChangeMode(const OperationMode_t& mode, const typename Clock_t::time_point& now)
+        {
+            m_Mode    = mode;
+            m_Status |= STATUS_MODE_CHANGED;
+
+            MicroSecs_t settlingTime = m_Timings.m_Mode3And4SettlingTime;
+            if (OperationMode_t::MODE_1 == mode)
+            {
+                settlingTime = m_Timings.m_Mode1SettlingTime;
+            }
+            else if (OperationMode_t::MODE_2 == mode)
+            {
+                settlingTime = m_Timings.m_Mode2SettlingTime;
+            }
+
+            m_ReadyTime = std::max(m_ReadyTime, now + settlingTime);
+        }
+
+        ReturnStatus_t GetReturnStatus(const typename Clock_t::time_point& now) const
+        {
+            ReturnStatus_t result = ReturnStatus_t::NORMAL_OPERATION_NO_FLAGS;
+
+            if (now < m_ReadyTime)
+            {
+                result = ReturnStatus_t::STARTUP_IN_PROGRESS;
+            }
+            else if (now < m_SelfTestEndTime)
+            {
+                result = ReturnStatus_t::RESERVED_SELF_TEST_RUNNING;
+            }
+            else if (m_Status || m_PoweredDown)
+            {
+                result = ReturnStatus_t::ERROR;
+            }
+
+            return result;
+        }
+
+        void Write(const RegisterAddress_t& address, const uint16_t& data,
+                   const typename Clock_t::time_point& now)
+        {
+            if (RegisterAddress_t::SELBANK == address)
+            {
+                m_Bank = (data & 0x0001) ? MemoryBank_t::BANK_1 : MemoryBank_t::BANK_0;
+            }
+            else if (MemoryBank_t::BANK_0 != m_Bank)
+            {
+                // Bank #1 only holds read-only registers.
+            }
+            else if (RegisterAddress_t::MODE == address)
+            {
+                if (data & COMMAND_SOFTWARE_RESET)
+                {
+                    Reset(m_Timings.m_ResetTime);
+                }
+                else if (data & COMMAND_POWERDOWN_MODE)
+                {
+                    m_PoweredDown = true;
+                    m_Status     |= STATUS_POWERED_DOWN;
+                }
+                else if (m_PoweredDown)
+                {
+                    // \" Wake up from power down mode \" resumes in mode 1.
+                    m_PoweredDown = false;
+                    m_ReadyTime   = now + m_Timings.m_WakeupTime;
+                    ChangeMode(OperationMode_t::MODE_1, now);
+                }
+                else
+                {
+                    ChangeMode(static_cast<OperationMode_t>(data & COMMAND_MODE_MASK), now);
+                }
+            }
+            else if (RegisterAddress_t::ANG_CTRL == address)
+            {
+                m_AngleControl = data;
+            }
+        }
+
+        uint16_t Read(const RegisterAddress_t& address, const typename Clock_t::time_point& now)
+        {
+            uint16_t result{0};
+
+            if (RegisterAddress_t::SELBANK == address)
+            {
+                return ToUnderlyingType(m_Bank);
+            }
+            else if (MemoryBank_t::BANK_1 == m_Bank)
+            {
+                // \" 3. Add letters “B33” to end \" of SERIAL2:SERIAL1.
+                if (RegisterAddress_t::SERIAL1 == address)
+                {
+                    result = static_cast<uint16_t>(m_SerialNumber & 0xFFFF);
+                }
+                else if (RegisterAddress_t::SERIAL2 == address)
+                {
+                    result = static_cast<uint16_t>(m_SerialNumber >> 16);
+                }
+                return result;
+            }
+
+            Sample(now);
+
+            switch (address)
+            {
+                case RegisterAddress_t::ACC_X:  result = m_Outputs[0]; break;
+                case RegisterAddress_t::ACC_Y:  result = m_Outputs[1]; break;
+                case RegisterAddress_t::ACC_Z:  result = m_Outputs[2]; break;
+                case RegisterAddress_t::STO:    result = m_Outputs[3]; break;
+                case RegisterAddress_t::TEMP:   result = m_Outputs[4]; break;
+                case RegisterAddress_t::ANG_X:  result = AreAnglesEnabled() ? m_Outputs[5] : 0; break;
+                case RegisterAddress_t::ANG_Y:  result = AreAnglesEnabled() ? m_Outputs[6] : 0; break;
+                case RegisterAddress_t::ANG_Z:  result = AreAnglesEnabled() ? m_Outputs[7] : 0; break;
+                case RegisterAddress_t::ANG_CTRL: result = m_AngleControl; break;
+                case RegisterAddress_t::MODE:   result = ToUnderlyingType(m_Mode); break;
+                case RegisterAddress_t::WHOAMI: result = WHO_AM_I; break;
+                case RegisterAddress_t::STATUS:
+                    // \" STATUS summary is reset by reading it. \"
+                    result   = m_Status;
+                    m_Status = m_PoweredDown ? STATUS_POWERED_DOWN : 0;
+                    break;
+                case RegisterAddress_t::ERR_FLAG1:
+                    result       = m_ErrorFlag1;
+                    m_ErrorFlag1 = 0;
+                    break;
+                case RegisterAddress_t::ERR_FLAG2:
+                    result       = m_ErrorFlag2;
+                    m_ErrorFlag2 = 0;
+                    break;
+                default:
+                    // \" User should not access Reserved nor Factory Use registers. \"
+                    break;
+            }
+
+            return result;
+        }
+
+        // Latches fresh outputs once per output data rate period.
+        void Sample(const typename Clock_t::time_point& now)
+        {
+            const DoubleSecs_t sinceBoot = now - m_PowerUpTime;
+            const auto sampleIndex = static_cast<int64_t>(sinceBoot.count() * m_Timings.m_OutputDataRateHz);
+
+            if ((sampleIndex == m_SampleIndex) || m_PoweredDown)
+            {
+                return;
+            }
+            m_SampleIndex = sampleIndex;
+
+            const auto stimulus = m_Waveform(DoubleSecs_t(static_cast<double>(sampleIndex)
+                                                          / m_Timings.m_OutputDataRateHz));
+
+            // \" 3000 LSB/g ... 6000 LSB/g ... 12000 LSB/g \"
+            double sensitivity = 12000.0;
+            if (OperationMode_t::MODE_1 == m_Mode)
+            {
+                sensitivity = 6000.0;
+            }
+            else if (OperationMode_t::MODE_2 == m_Mode)
+            {
+                sensitivity = 3000.0;
+            }
+
+            const auto ax = stimulus.m_AccelerationX;
+            const auto ay = stimulus.m_AccelerationY;
+            const auto az = stimulus.m_AccelerationZ;
+
+            // \" Angle [°] = d'ANG_% / 2^14 * 90 \"
+            constexpr double ANGLE_LSB_PER_RADIAN = 16384.0 / 90.0 / Waveforms::DEGREES_TO_RADIANS;
+
+            m_Outputs[0] = ToRegister(ax * sensitivity);
+            m_Outputs[1] = ToRegister(ay * sensitivity);
+            m_Outputs[2] = ToRegister(az * sensitivity);
+            m_Outputs[3] = 0; // Nominal STO, well within the Table 23 thresholds.
+
+            // \" Temperature [°C] = -273 + (TEMP / 18.9) \"
+            m_Outputs[4] = ToRegister((stimulus.m_Temperature + 273.0) * 18.9);
+
+            // \" ANG_X = atan2(accx / √(accy^2 + accz^2)) ... \"
+            m_Outputs[5] = ToRegister(std::atan2(ax, std::hypot(ay, az)) * ANGLE_LSB_PER_RADIAN);
+            m_Outputs[6] = ToRegister(std::atan2(ay, std::hypot(ax, az)) * ANGLE_LSB_PER_RADIAN);
+            m_Outputs[7] = ToRegister(std::atan2(az, std::hypot(ax, ay)) * ANGLE_LSB_PER_RADIAN);
+        }
+
+        static uint16_t ToRegister(const double& value)
+        {
+            // Saturate, as the signal path would, rather than wrap.
+            const auto clamped = std::clamp(std::lround(value),
+                                            static_cast<long>(std::numeric_limits<int16_t>::min()),
+                                            static_cast<long>(std::numeric_limits<int16_t>::max()));
+
+            return static_cast<uint16_t>(static_cast<int16_t>(clamped));
+        }
+
+    private:
+        Waveform_t                       m_Waveform;
+        SimulatorTimings_t               m_Timings;
+        uint32_t                         m_SerialNumber;
+
+        typename Clock_t::time_point     m_PowerUpTime;
+        typename Clock_t::time_point     m_ReadyTime{};
+        typename Clock_t::time_point     m_SelfTestEndTime{};
+        typename Clock_t::time_point     m_LastFrameTime{};
+
+        MemoryBank_t                     m_Bank{MemoryBank_t::BANK_0};
+        OperationMode_t                  m_Mode{OperationMode_t::MODE_1};
+        bool                             m_PoweredDown{false};
+        uint16_t                         m_AngleControl{0};
+        uint16_t                         m_Status{0};
+        uint16_t                         m_ErrorFlag1{0};
+        uint16_t                         m_ErrorFlag2{0};
+
+        // ACC_X, ACC_Y, ACC_Z, STO, TEMP, ANG_X, ANG_Y, ANG_Z.
+        std::array<uint16_t, 8>          m_Outputs{};
+        int64_t                          m_SampleIndex{-1};
+
+        uint64_t                         m_FrameCount{0};
+        uint64_t                         m_GapViolations{0};
+        uint64_t                         m_CRCErrors{0};
+    };
+
+    static_assert(SPIResponder<SCL3300Simulator<>>);
+
+} // End of namespace Simulation.
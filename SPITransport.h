@@ -0,0 +1,173 @@
+/***********************************************************************
+* @file      SPITransport.h
+*
+*    Compile-time SPI transport policies for the Murata Manufacturing
+*    Co. Ltd. SCL3300 3-Axis Inclinometer driver.
+*
+*    NuerteySCL3300Device is parameterized upon the type of its SPI bus.
+*    On target, this defaults to mbed::SPI. Elsewhere, e.g. on a Linux
+*    developer workstation, the very same protocol engine can be driven
+*    by the in-memory transport below; for instance so as to benchmark
+*    and profile it at millions of frames per second.
+*
+*    Being a template parameter rather than an interface, the transport
+*    is resolved entirely at compile time. That is, no virtual calls are
+*    incurred on the hot path.
+*
+* @brief
+*
+* @note
+*
+* @warning
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#pragma once
+
+#include <concepts>
+#include <cstring>
+#include <algorithm>
+
+#include "Protocol.h"
+
+// The subset of the mbed::SPI interface that NuerteySCL3300Device
+// relies upon for its blocking transfers.
+template <typename T>
+concept SPITransport = requires(T bus, const char* txBuffer, char* rxBuffer, int length)
+{
+    bus.format(length, length);
+    bus.frequency(length);
+    { bus.write(txBuffer, length, rxBuffer, length) } -> std::convertible_to<int>;
+};
+
+// Answers a single SPI request frame. Note that the transport, and not
+// the responder, is in charge of deferring that answer to the next frame.
+template <typename R>
+concept SPIResponder = requires(R responder, const SPICommandFrame_t& request)
+{
+    { responder(request) } -> std::convertible_to<SPICommandFrame_t>;
+};
+
+// A transport which is not wired to a physical sensor may opt out of the
+// 10 us inter-frame gap by declaring 'REQUIRES_INTER_FRAME_GAP = false'.
+template <typename T>
+consteval bool RequiresInterFrameGap()
+{
+    if constexpr (requires { T::REQUIRES_INTER_FRAME_GAP; })
+    {
+        return T::REQUIRES_INTER_FRAME_GAP;
+    }
+    else
+    {
+        return true;
+    }
+}
+
+namespace TransportPolicies
+{
+    using namespace Utilities;
+    using namespace ProtocolDefinitions;
+
+    // Composes a MISO frame, CRC included, as the sensor would.
+    //
+    // \" OP (RW + ADDR)[31:26] + RS[25:24] + DATA[23:8] + CRC[7:0] \"
+    inline SPICommandFrame_t MakeResponseFrame(const uint8_t& operationCode,
+                                               const ReturnStatus_t& returnStatus,
+                                               const uint16_t& data)
+    {
+        SPICommandFrame_t frame{static_cast<uint8_t>((operationCode & 0xFC)
+                                                   | ToUnderlyingType(returnStatus)),
+                                static_cast<uint8_t>(data >> 8),
+                                static_cast<uint8_t>(data & 0xFF),
+                                0x00};
+        frame.at(3) = CalculateCRC(frame);
+
+        return frame;
+    }
+
+    // Acknowledges every request with its own op code, RS '01' (normal
+    // operation) and an empty data field. Sufficient to exercise the
+    // framing, CRC and validation paths.
+    struct EchoResponder_t
+    {
+        SPICommandFrame_t operator()(const SPICommandFrame_t& request) const
+        {
+            return MakeResponseFrame(request.at(0),
+                                     ReturnStatus_t::NORMAL_OPERATION_NO_FLAGS,
+                                     0);
+        }
+    };
+
+    // In-memory stand-in for the SPI bus which honours the off-frame
+    // protocol; i.e. the response to frame k is only shifted out during
+    // frame k+1, exactly as the sensor does.
+    template <SPIResponder Responder_t = EchoResponder_t>
+    class InMemorySPITransport
+    {
+    public:
+        // There is no analog front-end to corrupt; hence frames may be
+        // issued back-to-back.
+        static constexpr bool REQUIRES_INTER_FRAME_GAP = false;
+
+        InMemorySPITransport() = default;
+
+        explicit InMemorySPITransport(Responder_t responder)
+            : m_Responder(std::move(responder))
+        {
+        }
+
+        void format(int bits, int mode = 0) { m_BitsPerWord = bits; m_Mode = mode; }
+        void frequency(int hz = 1000000) { m_Frequency = hz; }
+
+        // Mirrors mbed::SPI::write(); i.e. returns the number of bytes
+        // clocked, being the larger of the two buffer lengths.
+        int write(const char* txBuffer, int txLength, char* rxBuffer, int rxLength)
+        {
+            // Whilst this request is being shifted in, the response to
+            // the previous one is being shifted out.
+            const auto rxCount = std::min<std::size_t>(rxLength, m_PendingResponse.size());
+            std::memcpy(rxBuffer, m_PendingResponse.data(), rxCount);
+            std::memset(rxBuffer + rxCount, 0, rxLength - rxCount);
+
+            SPICommandFrame_t request{}; // Initialize to zeros.
+            std::memcpy(request.data(), txBuffer,
+                        std::min<std::size_t>(txLength, request.size()));
+            m_PendingResponse = m_Responder(request);
+            ++m_FrameCount;
+
+            return std::max(txLength, rxLength);
+        }
+
+        Responder_t&       GetResponder() { return m_Responder; }
+        const Responder_t& GetResponder() const { return m_Responder; }
+
+        uint64_t GetFrameCount() const { return m_FrameCount; }
+        int      GetBitsPerWord() const { return m_BitsPerWord; }
+        int      GetMode() const { return m_Mode; }
+        int      GetFrequency() const { return m_Frequency; }
+
+    private:
+        Responder_t        m_Responder{};
+
+        // Nothing meaningful is shifted out on the very first frame.
+        SPICommandFrame_t  m_PendingResponse{};
+        uint64_t           m_FrameCount{0};
+        int                m_BitsPerWord{8};
+        int                m_Mode{0};
+        int                m_Frequency{1000000};
+    };
+
+#if defined(__MBED__)
+    using DefaultSPITransport_t = mbed::SPI;
+#else
+    using DefaultSPITransport_t = InMemorySPITransport<>;
+#endif
+
+    static_assert(SPITransport<DefaultSPITransport_t>);
+    static_assert(SPITransport<InMemorySPITransport<>>);
+
+} // End of namespace TransportPolicies.
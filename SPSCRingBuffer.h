@@ -0,0 +1,157 @@
+/***********************************************************************
+* @file      SPSCRingBuffer.h
+*
+*    Wait-free single-producer/single-consumer ring buffer. Intended to
+*    hand SCL3300 samples from the acquisition context (a thread, or
+*    even an ISR) over to a processing thread without either side ever
+*    blocking the other.
+*
+*    The head and tail are free-running indices, each written by one side
+*    only, and reside on cache lines of their own so that the producer
+*    and consumer do not ping-pong a shared line between them.
+*
+* @brief
+*
+* @note    When full, the producer drops the newest element and counts
+*          an overrun rather than overwrite the oldest; i.e. the producer
+*          never has to touch the consumer's tail.
+*
+* @warning Exactly one producer and one consumer. Neither TryPush() nor
+*          PopBatch()/Drain() may be called concurrently with itself.
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#pragma once
+
+#include <span>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+namespace Utilities
+{
+#if defined(__MBED__)
+    // The L1 data cache line of the Cortex-M7.
+    constexpr std::size_t CACHE_LINE_SIZE = 32;
+#else
+    constexpr std::size_t CACHE_LINE_SIZE = 64;
+#endif
+
+    template <typename T, std::size_t Capacity>
+        requires (std::is_trivially_copyable_v<T> && std::has_single_bit(Capacity))
+    class SPSCRingBuffer
+    {
+        static constexpr std::size_t INDEX_MASK = Capacity - 1;
+
+        // An ISR may be the producer; the indices must never need a lock.
+        static_assert(std::atomic<std::size_t>::is_always_lock_free);
+        static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+    public:
+        static constexpr std::size_t CAPACITY = Capacity;
+
+        SPSCRingBuffer() = default;
+
+        SPSCRingBuffer(const SPSCRingBuffer&) = delete;
+        SPSCRingBuffer& operator=(const SPSCRingBuffer&) = delete;
+
+        // Producer side. Wait-free; returns false, and counts an overrun,
+        // should the consumer have fallen a full ring behind.
+        bool TryPush(const T& element)
+        {
+            const auto head = m_Head.load(std::memory_order_relaxed);
+            const auto tail = m_Tail.load(std::memory_order_acquire);
+
+            if ((head - tail) == Capacity)
+            {
+                m_Overruns.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            m_Slots[head & INDEX_MASK] = element;
+            m_Head.store(head + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        // Consumer side. Copies out up to 'elements.size()' of the oldest
+        // elements and returns how many were copied.
+        std::size_t PopBatch(std::span<T> elements)
+        {
+            return Drain([&elements, copied = std::size_t{0}](std::span<const T> run) mutable
+            {
+                std::copy(run.begin(), run.end(), elements.begin() + copied);
+                copied += run.size();
+            }, elements.size());
+        }
+
+        bool TryPop(T& element)
+        {
+            return (PopBatch(std::span<T>(&element, 1)) == 1);
+        }
+
+        // Consumer side, zero-copy. Hands 'consumer' the oldest elements,
+        // up to 'maximum' of them, in at most two contiguous runs (the
+        // second being due to wrap-around) and only then releases their
+        // slots to the producer. Returns the number of elements consumed.
+        template <typename F>
+        std::size_t Drain(F&& consumer, const std::size_t& maximum = Capacity)
+        {
+            const auto tail      = m_Tail.load(std::memory_order_relaxed);
+            const auto head      = m_Head.load(std::memory_order_acquire);
+            const auto count     = std::min<std::size_t>(head - tail, maximum);
+
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            const auto offset    = tail & INDEX_MASK;
+            const auto firstRun  = std::min(count, Capacity - offset);
+
+            consumer(std::span<const T>(m_Slots.data() + offset, firstRun));
+            if (firstRun < count)
+            {
+                consumer(std::span<const T>(m_Slots.data(), count - firstRun));
+            }
+
+            m_Tail.store(tail + count, std::memory_order_release);
+
+            return count;
+        }
+
+        // Approximate whilst the other side is active.
+        std::size_t GetSize() const
+        {
+            return (m_Head.load(std::memory_order_acquire)
+                  - m_Tail.load(std::memory_order_acquire));
+        }
+
+        bool IsEmpty() const { return (GetSize() == 0); }
+
+        uint32_t GetOverruns() const { return m_Overruns.load(std::memory_order_relaxed); }
+
+        // Pushed/popped totals wrap along with the indices themselves.
+        std::size_t GetPushedCount() const { return m_Head.load(std::memory_order_relaxed); }
+        std::size_t GetPoppedCount() const { return m_Tail.load(std::memory_order_relaxed); }
+
+    private:
+        // Written by the producer only.
+        alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_Head{0};
+        std::atomic<uint32_t>                             m_Overruns{0};
+
+        // Written by the consumer only.
+        alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_Tail{0};
+
+        alignas(CACHE_LINE_SIZE) std::array<T, Capacity>  m_Slots{};
+    };
+
+} // End of namespace Utilities.
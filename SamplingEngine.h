@@ -0,0 +1,443 @@
+/***********************************************************************
+* @file      SamplingEngine.h
+*
+*    Fixed-rate acquisition loop for the Murata Manufacturing Co. Ltd.
+*    SCL3300 3-Axis Inclinometer.
+*
+*    A dedicated, high-priority thread sweeps a configurable set of
+*    channels once per sampling period and hands each timestamped sample
+*    to the application, both through an optional callback and through
+*    a wait-free SPSC ring for bulk consumption by a processing thread.
+*    On target, the thread is released by a Ticker; elsewhere it merely
+*    sleeps until its next deadline.
+*
+*    Every sweep is measured against its ideal schedule; i.e. against
+*    the start time plus a whole number of periods. The following are
+*    then accounted for:
+*
+*    - Jitter:           How late a sweep started relative to its slot.
+*    - Overruns:         Sweeps which outlasted their own period.
+*    - Missed deadlines: Slots which elapsed without a sweep at all.
+*
+* @brief
+*
+* @note    Whilst the engine is running, the device belongs to the
+*          sampling thread. Stop() the engine before issuing any other
+*          SPI traffic, e.g. self-test monitoring or a mode change.
+*
+* @warning
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#if !defined(__MBED__)
+#include <thread>
+#include <functional>
+#endif
+
+#include "NuerteySCL3300Device.h"
+#include "SPSCRingBuffer.h"
+
+namespace Acquisition
+{
+#if defined(__MBED__)
+    // Invoked in the context of the sampling thread; keep it brief.
+    using SampleHandler_t = mbed::Callback<void(const SCL3300Sample_t&)>;
+    using EngineMutex_t   = rtos::Mutex;
+#else
+    using SampleHandler_t = std::function<void(const SCL3300Sample_t&)>;
+    using EngineMutex_t   = std::mutex;
+#endif
+
+    // ~1.3 s of history at 100 Hz.
+    constexpr std::size_t DEFAULT_SAMPLE_RING_CAPACITY = 128;
+
+    struct SamplingStatistics_t
+    {
+        uint32_t    m_SweepsCompleted{0};
+        uint32_t    m_SweepsFailed{0};
+        uint32_t    m_Overruns{0};
+        uint32_t    m_MissedDeadlines{0};
+        MicroSecs_t m_MinimumJitter{MicroSecs_t::max()};
+        MicroSecs_t m_MaximumJitter{0};
+        MicroSecs_t m_TotalJitter{0};
+        MicroSecs_t m_MaximumSweepDuration{0};
+
+        MicroSecs_t GetMeanJitter() const
+        {
+            const auto sweeps = m_SweepsCompleted + m_SweepsFailed;
+            return (sweeps == 0) ? MicroSecs_t{0} : (m_TotalJitter / sweeps);
+        }
+    };
+
+    template <typename Device_t, std::size_t SampleRingCapacity = DEFAULT_SAMPLE_RING_CAPACITY>
+    class SamplingEngine
+    {
+#if defined(__MBED__)
+        static constexpr uint32_t TICK_FLAG = (1UL << 0);
+        static constexpr uint32_t STOP_FLAG = (1UL << 1);
+
+        // Sufficient for a pipelined sweep plus a modest sample handler.
+        static constexpr uint32_t SAMPLING_THREAD_STACK_SIZE = 2048;
+#endif
+
+    public:
+        // Samples are handed from the sampling thread to a single consumer
+        // thread through this ring; the sampler never waits upon it.
+        using SampleRing_t = SPSCRingBuffer<SCL3300Sample_t, SampleRingCapacity>;
+
+        explicit SamplingEngine(Device_t& device);
+
+        SamplingEngine(const SamplingEngine&) = delete;
+        SamplingEngine& operator=(const SamplingEngine&) = delete;
+
+        ~SamplingEngine();
+
+        // The period may not be shorter than the output data rate of the
+        // device's current operation mode permits.
+        std::error_code Configure(const ChannelSet_t& channels,
+                                  const MicroSecs_t& period);
+
+        std::error_code Start(SampleHandler_t onSample);
+        void Stop();
+
+        bool IsRunning() const { return m_Running; }
+
+        ChannelSet_t GetChannels() const { return m_Channels; }
+        MicroSecs_t  GetPeriod() const { return m_Period; }
+
+        // Consumer side of the sample ring; drain it in bulk.
+        SampleRing_t&       GetSampleRing() { return m_Samples; }
+        const SampleRing_t& GetSampleRing() const { return m_Samples; }
+
+        SamplingStatistics_t GetStatistics() const;
+        void ResetStatistics();
+        void PrintStatistics() const;
+
+    protected:
+        void Run();
+
+        // Sweeps the configured channels and accounts for the sweep
+        // against the ideal schedule.
+        void Sweep();
+
+#if defined(__MBED__)
+        void OnTick();
+#endif
+
+    private:
+        Device_t&                      m_Device;
+        ChannelSet_t                   m_Channels;
+        MicroSecs_t                    m_Period;
+        SampleHandler_t                m_OnSample;
+        std::atomic<bool>              m_Running;
+
+        MonotonicClock_t::time_point   m_StartTime;
+        int64_t                        m_LastSlot;
+
+        // Held for the duration of each sweep, and whilst the statistics
+        // are accessed from without the sampling thread.
+        mutable EngineMutex_t          m_SweepMutex;
+        SamplingStatistics_t           m_Statistics;
+
+        SampleRing_t                   m_Samples;
+
+#if defined(__MBED__)
+        // Started upon the first Start() and parked, rather than joined,
+        // upon Stop(); an rtos::Thread cannot be restarted.
+        rtos::Thread                   m_Thread;
+        bool                           m_ThreadStarted;
+
+        // A LowPowerTicker would also do where deep sleep matters, at
+        // the expense of the ~30 us resolution of the low power timer.
+        mbed::Ticker                   m_Ticker;
+#else
+        std::thread                    m_Thread;
+#endif
+    };
+
+    template <typename Device_t, std::size_t SampleRingCapacity>
+    SamplingEngine<Device_t, SampleRingCapacity>::SamplingEngine(Device_t& device)
+        : m_Device(device)
+        , m_Channels(ALL_CHANNELS)
+        , m_Period(GetMinimumSamplingPeriod(device.GetInclinometerMode()))
+        , m_OnSample()
+        , m_Running(false)
+        , m_StartTime()
+        , m_LastSlot(0)
+        , m_SweepMutex()
+        , m_Statistics()
+        , m_Samples()
+#if defined(__MBED__)
+        , m_Thread(osPriorityRealtime, SAMPLING_THREAD_STACK_SIZE, nullptr, "SCL3300Sampler")
+        , m_ThreadStarted(false)
+        , m_Ticker()
+#else
+        , m_Thread()
+#endif
+    {
+    }
+
+    template <typename Device_t, std::size_t SampleRingCapacity>
+    SamplingEngine<Device_t, SampleRingCapacity>::~SamplingEngine()
+    {
+        Stop();
+
+#if defined(__MBED__)
+        if (m_ThreadStarted)
+        {
+            m_Thread.flags_set(STOP_FLAG);
+            m_Thread.join();
+        }
+#endif
+    }
+
+    template <typename Device_t, std::size_t SampleRingCapacity>
+    std::error_code SamplingEngine<Device_t, SampleRingCapacity>::Configure(const ChannelSet_t& channels,
+                                                                            const MicroSecs_t& period)
+    {
+        std::error_code result{};
+
+        if (m_Running)
+        {
+            result = make_error_code(SensorStatus_t::ERROR_SAMPLING_ENGINE_RUNNING);
+        }
+        else if (channels.none())
+        {
+            result = make_error_code(SensorStatus_t::ERROR_EMPTY_CHANNEL_SET);
+        }
+        else if (period < GetMinimumSamplingPeriod(m_Device.GetInclinometerMode()))
+        {
+            result = make_error_code(SensorStatus_t::ERROR_SAMPLING_PERIOD_TOO_SHORT);
+        }
+        else
+        {
+            m_Channels = channels;
+            m_Period   = period;
+        }
+
+        if (result)
+        {
+            printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
+                      result.value(), GetErrorMessage(result));
+        }
+
+        return result;
+    }
+
+    template <typename Device_t, std::size_t SampleRingCapacity>
+    std::error_code SamplingEngine<Device_t, SampleRingCapacity>::Start(SampleHandler_t onSample)
+    {
+        if (m_Running)
+        {
+            return make_error_code(SensorStatus_t::ERROR_SAMPLING_ENGINE_RUNNING);
+        }
+
+        m_OnSample  = onSample;
+        m_StartTime = MonotonicClock_t::now();
+        m_LastSlot  = -1;
+        m_Running   = true;
+
+#if defined(__MBED__)
+        if (!m_ThreadStarted)
+        {
+            m_Thread.start(mbed::callback(this, &SamplingEngine::Run));
+            m_ThreadStarted = true;
+        }
+
+        // The very first sweep is due immediately; the Ticker only fires
+        // one period hence.
+        m_Thread.flags_set(TICK_FLAG);
+        m_Ticker.attach(mbed::callback(this, &SamplingEngine::OnTick), m_Period);
+#else
+        m_Thread = std::thread(&SamplingEngine::Run, this);
+#endif
+
+        return make_error_code(SensorStatus_t::SUCCESS);
+    }
+
+    template <typename Device_t, std::size_t SampleRingCapacity>
+    void SamplingEngine<Device_t, SampleRingCapacity>::Stop()
+    {
+        if (!m_Running.exchange(false))
+        {
+            return;
+        }
+
+#if defined(__MBED__)
+        m_Ticker.detach();
+
+        // Wait out any sweep in flight so that the caller may then use
+        // the device at once.
+        std::lock_guard<EngineMutex_t> guard(m_SweepMutex);
+#else
+        if (m_Thread.joinable())
+        {
+            m_Thread.join();
+        }
+#endif
+    }
+
+    template <typename Device_t, std::size_t SampleRingCapacity>
+    SamplingStatistics_t SamplingEngine<Device_t, SampleRingCapacity>::GetStatistics() const
+    {
+        std::lock_guard<EngineMutex_t> guard(m_SweepMutex);
+        return m_Statistics;
+    }
+
+    template <typename Device_t, std::size_t SampleRingCapacity>
+    void SamplingEngine<Device_t, SampleRingCapacity>::ResetStatistics()
+    {
+        std::lock_guard<EngineMutex_t> guard(m_SweepMutex);
+        m_Statistics = SamplingStatistics_t{};
+    }
+
+    template <typename Device_t, std::size_t SampleRingCapacity>
+    void SamplingEngine<Device_t, SampleRingCapacity>::PrintStatistics() const
+    {
+        const auto statistics = GetStatistics();
+
+        printf("\nSampling Engine Statistics (%s):\n", m_Running ? "running" : "stopped");
+        printf("\tPeriod                  := [%lld us]\n", static_cast<long long>(m_Period.count()));
+        printf("\tSweeps Completed        := [%lu]\n", static_cast<unsigned long>(statistics.m_SweepsCompleted));
+        printf("\tSweeps Failed           := [%lu]\n", static_cast<unsigned long>(statistics.m_SweepsFailed));
+        printf("\tOverruns                := [%lu]\n", static_cast<unsigned long>(statistics.m_Overruns));
+        printf("\tMissed Deadlines        := [%lu]\n", static_cast<unsigned long>(statistics.m_MissedDeadlines));
+        printf("\tSample Ring Overruns    := [%lu]\n", static_cast<unsigned long>(m_Samples.GetOverruns()));
+
+        if ((statistics.m_SweepsCompleted + statistics.m_SweepsFailed) > 0)
+        {
+            printf("\tJitter (min/mean/max)   := [%lld/%lld/%lld us]\n",
+                static_cast<long long>(statistics.m_MinimumJitter.count()),
+                static_cast<long long>(statistics.GetMeanJitter().count()),
+                static_cast<long long>(statistics.m_MaximumJitter.count()));
+            printf("\tMaximum Sweep Duration  := [%lld us]\n",
+                static_cast<long long>(statistics.m_MaximumSweepDuration.count()));
+        }
+    }
+
+    template <typename Device_t, std::size_t SampleRingCapacity>
+    void SamplingEngine<Device_t, SampleRingCapacity>::Run()
+    {
+#if defined(__MBED__)
+        while (true)
+        {
+            const auto flags = ThisThread::flags_wait_any(TICK_FLAG | STOP_FLAG);
+            if (flags & STOP_FLAG)
+            {
+                break;
+            }
+
+            if (m_Running)
+            {
+                Sweep();
+            }
+        }
+#else
+        while (m_Running)
+        {
+            Sweep();
+
+            // Sleep until the slot following the one just serviced.
+            const auto nextSlot = m_StartTime + (m_LastSlot + 1) * m_Period;
+            const auto now      = MonotonicClock_t::now();
+            if (nextSlot > now)
+            {
+                std::this_thread::sleep_for(nextSlot - now);
+            }
+        }
+#endif
+    }
+
+    template <typename Device_t, std::size_t SampleRingCapacity>
+    void SamplingEngine<Device_t, SampleRingCapacity>::Sweep()
+    {
+        std::lock_guard<EngineMutex_t> guard(m_SweepMutex);
+
+        // Re-checked under the lock: Stop() may have run in between Run()
+        // testing m_Running and the lock being taken, and so have already
+        // handed the device back to its caller.
+        if (!m_Running)
+        {
+            return;
+        }
+
+        const auto startTime = MonotonicClock_t::now();
+        const auto elapsed   = std::chrono::duration_cast<MicroSecs_t>(startTime - m_StartTime);
+
+        // The slot being serviced is the latest one to have begun; any
+        // slot skipped over since the last sweep was missed outright.
+        const int64_t slot   = elapsed / m_Period;
+        const auto    jitter = elapsed - (slot * m_Period);
+
+        if (slot == m_LastSlot)
+        {
+            // A spurious wakeup, e.g. a tick latched whilst the previous
+            // sweep was overrunning. This slot has already been serviced.
+            return;
+        }
+
+        if (slot > (m_LastSlot + 1))
+        {
+            m_Statistics.m_MissedDeadlines += static_cast<uint32_t>(slot - m_LastSlot - 1);
+        }
+        m_LastSlot = slot;
+
+        auto result = m_Device.ReadChannelsPipelined(m_Channels);
+
+        const auto endTime  = MonotonicClock_t::now();
+        const auto duration = std::chrono::duration_cast<MicroSecs_t>(endTime - startTime);
+
+        if (!result)
+        {
+            ++m_Statistics.m_SweepsCompleted;
+        }
+        else
+        {
+            ++m_Statistics.m_SweepsFailed;
+        }
+
+        m_Statistics.m_MinimumJitter        = std::min(m_Statistics.m_MinimumJitter, jitter);
+        m_Statistics.m_MaximumJitter        = std::max(m_Statistics.m_MaximumJitter, jitter);
+        m_Statistics.m_TotalJitter         += jitter;
+        m_Statistics.m_MaximumSweepDuration = std::max(m_Statistics.m_MaximumSweepDuration, duration);
+
+        // Overran if the sweep spilled past the end of its own slot.
+        if (endTime > (m_StartTime + (slot + 1) * m_Period))
+        {
+            ++m_Statistics.m_Overruns;
+        }
+
+        if (!result)
+        {
+            const auto sample = m_Device.GetLatestSample();
+
+            // Should the consumer have fallen behind, the sample is dropped
+            // and counted rather than waited upon.
+            m_Samples.TryPush(sample);
+
+            if (m_OnSample)
+            {
+                m_OnSample(sample);
+            }
+        }
+    }
+
+#if defined(__MBED__)
+    template <typename Device_t, std::size_t SampleRingCapacity>
+    void SamplingEngine<Device_t, SampleRingCapacity>::OnTick()
+    {
+        // Interrupt context; defer the sweep to the sampling thread.
+        m_Thread.flags_set(TICK_FLAG);
+    }
+#endif
+
+} // End of namespace Acquisition.
@@ -0,0 +1,965 @@
+/***********************************************************************
+* @file      SensorStateMachine.h
+*
+*    Event-driven lifecycle of the Murata Manufacturing Co. Ltd. SCL3300
+*    3-Axis Inclinometer; i.e. a non-blocking counterpart to the device's
+*    LaunchStartupSequence(), LaunchSelfTestMonitoring() and reset paths.
+*
+*    The sensor moves through the following states:
+*
+*    - Startup:    Wake-up, software reset and mode selection, per
+*                  \" Table 11 Start-Up Sequence \".
+*    - Settling:   Waiting out the signal path settling time of the mode,
+*                  after which STATUS is cleared. Or, under the readiness
+*                  polling start-up policy, polling the RS bits for the
+*                  sensor having settled ahead of that time.
+*    - Normal:     Optionally sweeping all channels at a fixed period,
+*                  watching STATUS for flags which call for a reset.
+*    - SelfTest:   Evaluating the STO signal over a few sweeps.
+*    - PowerDown:  Powered down, either upon request or once recovery
+*                  has been given up upon.
+*    - Recovery:   Software reset, followed by the start-up sequence anew.
+*
+*    Alternatively, acquisition may be duty-cycled: the sensor is woken up
+*    once per period, started up, swept in a short burst and powered down
+*    again; i.e. it sleeps in PowerDown for most of each period.
+*
+*    No state ever sleeps. Every wait is an EventQueue timeout and every
+*    DMA transfer completion is posted back to that same queue; i.e. the
+*    thread dispatching the queue is free to service other work, and
+*    other sensors, whilst this one settles.
+*
+* @brief
+*
+* @note    All transitions execute in the context of the thread which
+*          dispatches the queue. Start() and the Request*() methods
+*          merely post to it, and so may be called from any thread.
+*
+* @warning Whilst Startup, Settling, SelfTest or Recovery, or whilst
+*          Normal with a monitoring period configured, the device belongs
+*          to the queue. Issue no other SPI traffic until it is Normal
+*          (and unmonitored) or PowerDown.
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#pragma once
+
+#include <atomic>
+#include <concepts>
+
+#if !defined(__MBED__)
+#include <functional>
+#endif
+
+#include "NuerteySCL3300Device.h"
+
+namespace Supervision
+{
+    enum class SensorState_t : uint8_t
+    {
+        STARTUP,
+        SETTLING,
+        NORMAL,
+        SELF_TEST,
+        POWER_DOWN,
+        RECOVERY,
+        NUMBER_OF_STATES
+    };
+
+    constexpr std::array<std::string_view, ToUnderlyingType(SensorState_t::NUMBER_OF_STATES)> SENSOR_STATE_NAMES{{
+        "Startup", "Settling", "Normal", "SelfTest", "PowerDown", "Recovery"}};
+
+    constexpr std::string_view ToString(const SensorState_t& state)
+    {
+        return SENSOR_STATE_NAMES[ToUnderlyingType(state)];
+    }
+
+#if defined(__MBED__)
+    // Both are invoked in the context of the thread dispatching the queue.
+    using StateHandler_t  = mbed::Callback<void(SensorState_t)>;
+    using SampleHandler_t = mbed::Callback<void(const SCL3300Sample_t&)>;
+#else
+    using StateHandler_t  = std::function<void(SensorState_t)>;
+    using SampleHandler_t = std::function<void(const SCL3300Sample_t&)>;
+#endif
+
+    // That subset of events::EventQueue which is relied upon. Either call
+    // returns zero should the queue have run out of event memory.
+    template <typename Q>
+    concept TimedEventQueue = requires(Q& queue, void (*event)(), MilliSecs_t delay, int id)
+    {
+        { queue.call(event) } -> std::convertible_to<int>;
+        { queue.call_in(delay, event) } -> std::convertible_to<int>;
+        queue.cancel(id);
+    };
+
+    // STO reads per self-test; as per LaunchSelfTestMonitoring().
+    constexpr uint32_t SELF_TEST_SWEEPS = 3;
+
+    // Successive self-test sweeps are an ODR period or more apart, though
+    // an EventQueue only resolves milliseconds.
+    constexpr MilliSecs_t SELF_TEST_SWEEP_SPACING{1};
+
+    // Software resets attempted, without an intervening good sweep,
+    // before the sensor is presumed to need a HW reset.
+    constexpr uint32_t MAXIMUM_RECOVERY_ATTEMPTS = 3;
+
+    // Failed sweeps in a row tolerated whilst Normal.
+    constexpr uint32_t MAXIMUM_CONSECUTIVE_SWEEP_FAILURES = 3;
+
+    // Every m_Period, the sensor is woken up and started up, swept 
+    // m_BurstLength times m_BurstSpacing apart, and then powered down. 
+    // Every m_AveragedSweeps good sweeps are averaged into one delivered 
+    // sample; should a burst end with fewer, they are averaged regardless.
+    struct DutyCycle_t
+    {
+        MilliSecs_t m_Period{0};
+        uint32_t    m_BurstLength{1};
+        uint32_t    m_AveragedSweeps{1};
+        MilliSecs_t m_BurstSpacing{1};
+    };
+
+    // The sweeps of a burst must fit within the period, else every
+    // wake-up would overrun.
+    constexpr bool IsValidDutyCycle(const DutyCycle_t& dutyCycle)
+    {
+        return (dutyCycle.m_Period > MilliSecs_t(0))
+            && (dutyCycle.m_BurstLength > 0)
+            && (dutyCycle.m_AveragedSweeps > 0)
+            && (dutyCycle.m_AveragedSweeps <= dutyCycle.m_BurstLength)
+            && (dutyCycle.m_BurstSpacing >= MilliSecs_t(0))
+            && (((dutyCycle.m_BurstLength - 1) * dutyCycle.m_BurstSpacing) < dutyCycle.m_Period);
+    }
+
+    // The energy-relevant accounting of a duty-cycled run. Awake time
+    // spans wake-up command to power down command, start-up included.
+    struct DutyCycleStatistics_t
+    {
+        MilliSecs_t m_Period{0};
+        uint32_t    m_Cycles{0};
+        uint32_t    m_Overruns{0};   // Wake-ups already due as the previous cycle ended.
+        uint32_t    m_SweepsCompleted{0};
+        uint32_t    m_SweepsFailed{0};
+        uint32_t    m_SamplesDelivered{0};
+        uint32_t    m_SPIFrames{0};
+        MicroSecs_t m_AwakeTime{0};
+
+        uint64_t GetSPIBytes() const
+        {
+            return static_cast<uint64_t>(m_SPIFrames) * NUMBER_OF_SPI_COMMAND_FRAME_BYTES;
+        }
+
+        double GetFramesPerSample() const
+        {
+            return (m_SamplesDelivered == 0) ? 0.0 
+                 : (static_cast<double>(m_SPIFrames) / m_SamplesDelivered);
+        }
+
+        // Of the nominal time spanned by the cycles so far.
+        double GetAwakeFraction() const
+        {
+            const auto nominal = std::chrono::duration_cast<MicroSecs_t>(m_Period) * m_Cycles;
+
+            return (nominal.count() == 0) ? 0.0
+                 : (static_cast<double>(m_AwakeTime.count()) / nominal.count());
+        }
+    };
+
+    // Mean of a group of sweeps, in raw LSB rounded to nearest. STATUS 
+    // gathers the flags of every sweep and WHOAMI is merely carried over,
+    // as are the RS bits and sequence number of the latest sweep. The 
+    // timestamp lies midway between the first and latest sweeps.
+    class SampleAverager
+    {
+    public:
+        void Reset() { m_Count = 0; }
+
+        uint32_t GetCount() const { return m_Count; }
+
+        void Add(const SCL3300Sample_t& sample)
+        {
+            if (m_Count == 0)
+            {
+                m_Sums.fill(0);
+                m_StatusFlags    = 0;
+                m_FirstTimestamp = sample.m_Timestamp;
+            }
+
+            for (std::size_t index = 0; index < NUMBER_OF_CHANNELS; ++index)
+            {
+                m_Sums[index] += sample.m_Raw[index];
+            }
+
+            m_StatusFlags |= sample.GetUnsigned(Channel_t::STATUS_SUMMARY);
+            m_Latest       = sample;
+            ++m_Count;
+        }
+
+        // Only meaningful whilst GetCount() is non-zero.
+        SCL3300Sample_t GetAverage() const
+        {
+            auto result = m_Latest;
+            const auto count = static_cast<int32_t>(m_Count);
+
+            for (std::size_t index = 0; index < NUMBER_OF_CHANNELS; ++index)
+            {
+                const auto sum = m_Sums[index];
+                result.m_Raw[index] = static_cast<int16_t>((sum + ((sum < 0) ? -count : count) / 2) / count);
+            }
+
+            result.m_Raw[ToUnderlyingType(Channel_t::STATUS_SUMMARY)] = static_cast<int16_t>(m_StatusFlags);
+            result.m_Raw[ToUnderlyingType(Channel_t::WHO_AM_I)]       = m_Latest.Get(Channel_t::WHO_AM_I);
+            result.m_Timestamp = m_FirstTimestamp + (m_Latest.m_Timestamp - m_FirstTimestamp) / 2;
+
+            return result;
+        }
+
+    private:
+        std::array<int32_t, NUMBER_OF_CHANNELS> m_Sums{};
+        uint16_t                                m_StatusFlags{0};
+        SCL3300Sample_t                         m_Latest{};
+        MonotonicClock_t::time_point            m_FirstTimestamp{};
+        uint32_t                                m_Count{0};
+    };
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    class SensorStateMachine
+    {
+    public:
+        SensorStateMachine(Device_t& device, EventQueue_t& queue);
+
+        SensorStateMachine(const SensorStateMachine&) = delete;
+        SensorStateMachine& operator=(const SensorStateMachine&) = delete;
+
+        ~SensorStateMachine();
+
+        // A monitoring period of zero leaves the device idle whilst Normal,
+        // e.g. for a SamplingEngine to take over. Configure whilst stopped,
+        // i.e. before Start() or whilst PowerDown. Whilst duty-cycling,
+        // 'onSample' is handed the averaged samples instead, and the 
+        // monitoring period is disregarded.
+        void Configure(const MilliSecs_t& monitoringPeriod,
+                       StateHandler_t onStateChange = {},
+                       SampleHandler_t onSample = {});
+
+        // (Re)starts the sensor from whichever state, waking it up first
+        // if powered down, so as to remain Normal.
+        std::error_code Start();
+
+        // As above, but duty-cycling the sensor from then on, until the
+        // next Start() or RequestPowerDown().
+        std::error_code StartDutyCycle(const DutyCycle_t& dutyCycle);
+
+        // Honoured whilst Normal only.
+        std::error_code RequestSelfTest();
+
+        std::error_code RequestPowerDown();
+
+        SensorState_t GetState() const { return m_State; }
+
+        // The outcome of the most recent self-test, recovery, or failed
+        // transition.
+        std::error_code GetLastError() const { return m_LastError; }
+
+        bool IsDutyCycling() const { return (m_DutyCycle.m_Period > MilliSecs_t(0)); }
+
+        // Of the latest duty-cycled run. Updated from the queue's thread;
+        // hence consult whilst PowerDown, or once Start()ed anew.
+        const DutyCycleStatistics_t& GetDutyCycleStatistics() const { return m_DutyCycleStatistics; }
+        void PrintDutyCycleStatistics() const;
+
+    protected:
+        enum class Request_t : uint8_t
+        {
+            NONE,
+            START,
+            START_DUTY_CYCLE,
+            SELF_TEST,
+            POWER_DOWN
+        };
+
+        enum class StartupStep_t : uint8_t
+        {
+            WAKE_UP,
+            SOFTWARE_RESET,
+            SET_MEASUREMENT_MODE
+        };
+
+        using Step_t = void (SensorStateMachine::*)();
+
+        template <typename F>
+        std::error_code PostEvent(F&& event);
+        std::error_code Post(const Request_t& request);
+        void HandleRequest(const Request_t& request);
+
+        void Schedule(const MilliSecs_t& delay, Step_t step);
+        void CancelScheduled();
+
+        void EnterState(const SensorState_t& state);
+        void EnterNormal();
+        void EnterRecovery(const std::error_code& cause);
+
+        // Commences start-up, and if duty-cycling, a new cycle.
+        void BeginStartup();
+
+        // Powers the sensor down, concluding any cycle in progress.
+        void PowerDownSensor();
+        void ConcludeCycle();
+
+        void ConcludeBurst();
+        void DeliverAverage();
+
+        // The individual steps, each executing in queue context.
+        void OnStartupStep();
+        void OnSettled();
+        void OnReadinessPoll();
+        void OnRecoveryReset();
+        void OnMonitoringTick();
+
+        void StartSweep();
+
+        // Interrupt context; defers to OnSweepComplete().
+        void OnTransferComplete(std::error_code result);
+        void OnSweepComplete(const std::error_code& result);
+
+        void RecordQueueExhausted();
+
+    private:
+        Device_t&                      m_Device;
+        EventQueue_t&                  m_Queue;
+
+        MilliSecs_t                    m_MonitoringPeriod;
+        StateHandler_t                 m_OnStateChange;
+        SampleHandler_t                m_OnSample;
+
+        std::atomic<SensorState_t>     m_State;
+        std::error_code                m_LastError;
+
+        StartupStep_t                  m_StartupStep;
+        MonotonicClock_t::time_point   m_SettlingDeadline;
+        int                            m_ScheduledEvent;  // Zero if none.
+
+        // A request arriving mid-sweep is held until the sweep completes,
+        // as the bus may not be shared with an asynchronous transfer.
+        bool                           m_SweepInFlight;
+        Request_t                      m_DeferredRequest;
+
+        uint32_t                       m_ConsecutiveSweepFailures;
+        uint32_t                       m_RecoveryAttempts;
+        uint32_t                       m_SelfTestSweeps;
+        uint32_t                       m_SelfTestFailures;
+
+        // Disabled whilst its period is zero. The pending one is handed
+        // over from StartDutyCycle() via the queue.
+        DutyCycle_t                    m_DutyCycle;
+        DutyCycle_t                    m_PendingDutyCycle;
+        DutyCycleStatistics_t          m_DutyCycleStatistics;
+        SampleAverager                 m_Averager;
+        uint32_t                       m_BurstSweeps;
+        bool                           m_CycleInProgress;
+        MonotonicClock_t::time_point   m_CycleStartTime;
+        MonotonicClock_t::time_point   m_NextWakeupTime; // Nominal; i.e. drift-free.
+        uint32_t                       m_CycleStartFrames;
+    };
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    SensorStateMachine<Device_t, EventQueue_t>::SensorStateMachine(Device_t& device, EventQueue_t& queue)
+        : m_Device(device)
+        , m_Queue(queue)
+        , m_MonitoringPeriod(0)
+        , m_OnStateChange()
+        , m_OnSample()
+        , m_State(SensorState_t::POWER_DOWN)
+        , m_LastError()
+        , m_StartupStep(StartupStep_t::SOFTWARE_RESET)
+        , m_SettlingDeadline()
+        , m_ScheduledEvent(0)
+        , m_SweepInFlight(false)
+        , m_DeferredRequest(Request_t::NONE)
+        , m_ConsecutiveSweepFailures(0)
+        , m_RecoveryAttempts(0)
+        , m_SelfTestSweeps(0)
+        , m_SelfTestFailures(0)
+        , m_DutyCycle()
+        , m_PendingDutyCycle()
+        , m_DutyCycleStatistics()
+        , m_Averager()
+        , m_BurstSweeps(0)
+        , m_CycleInProgress(false)
+        , m_CycleStartTime()
+        , m_NextWakeupTime()
+        , m_CycleStartFrames(0)
+    {
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    SensorStateMachine<Device_t, EventQueue_t>::~SensorStateMachine()
+    {
+        CancelScheduled();
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::Configure(const MilliSecs_t& monitoringPeriod,
+                                                               StateHandler_t onStateChange,
+                                                               SampleHandler_t onSample)
+    {
+        m_MonitoringPeriod = monitoringPeriod;
+        m_OnStateChange    = onStateChange;
+        m_OnSample         = onSample;
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    std::error_code SensorStateMachine<Device_t, EventQueue_t>::Start()
+    {
+        return Post(Request_t::START);
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    std::error_code SensorStateMachine<Device_t, EventQueue_t>::StartDutyCycle(const DutyCycle_t& dutyCycle)
+    {
+        if (!IsValidDutyCycle(dutyCycle))
+        {
+            const auto result = make_error_code(SensorStatus_t::ERROR_INVALID_DUTY_CYCLE);
+
+            printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
+                      result.value(), GetErrorMessage(result));
+            return result;
+        }
+
+        return PostEvent([this, dutyCycle]
+        {
+            m_PendingDutyCycle = dutyCycle;
+            HandleRequest(Request_t::START_DUTY_CYCLE);
+        });
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    std::error_code SensorStateMachine<Device_t, EventQueue_t>::RequestSelfTest()
+    {
+        return Post(Request_t::SELF_TEST);
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    std::error_code SensorStateMachine<Device_t, EventQueue_t>::RequestPowerDown()
+    {
+        return Post(Request_t::POWER_DOWN);
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    std::error_code SensorStateMachine<Device_t, EventQueue_t>::Post(const Request_t& request)
+    {
+        return PostEvent([this, request] { HandleRequest(request); });
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    template <typename F>
+    std::error_code SensorStateMachine<Device_t, EventQueue_t>::PostEvent(F&& event)
+    {
+        std::error_code result{};
+
+        if (m_Queue.call(std::forward<F>(event)) == 0)
+        {
+            result = make_error_code(SensorStatus_t::ERROR_EVENT_QUEUE_EXHAUSTED);
+
+            printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
+                      result.value(), GetErrorMessage(result));
+        }
+
+        return result;
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::HandleRequest(const Request_t& request)
+    {
+        if (m_SweepInFlight)
+        {
+            // The latest request wins.
+            m_DeferredRequest = request;
+            return;
+        }
+
+        switch (request)
+        {
+            case Request_t::START:
+                m_DutyCycle = DutyCycle_t{};
+                BeginStartup();
+                break;
+
+            case Request_t::START_DUTY_CYCLE:
+                m_DutyCycle           = m_PendingDutyCycle;
+                m_DutyCycleStatistics = DutyCycleStatistics_t{m_DutyCycle.m_Period};
+                m_NextWakeupTime      = MonotonicClock_t::now();
+                BeginStartup();
+                break;
+
+            case Request_t::SELF_TEST:
+                if (m_State == SensorState_t::NORMAL)
+                {
+                    CancelScheduled();
+                    m_SelfTestSweeps   = 0;
+                    m_SelfTestFailures = 0;
+                    EnterState(SensorState_t::SELF_TEST);
+                    StartSweep();
+                }
+                break;
+
+            case Request_t::POWER_DOWN:
+                CancelScheduled();
+                m_DutyCycle = DutyCycle_t{};
+                PowerDownSensor();
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::Schedule(const MilliSecs_t& delay, Step_t step)
+    {
+        // At most one timeout is ever pending; whichever transition comes
+        // next supersedes it.
+        CancelScheduled();
+
+        m_ScheduledEvent = m_Queue.call_in(delay, [this, step]
+        {
+            m_ScheduledEvent = 0;
+            (this->*step)();
+        });
+
+        if (m_ScheduledEvent == 0)
+        {
+            RecordQueueExhausted();
+        }
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::CancelScheduled()
+    {
+        if (m_ScheduledEvent != 0)
+        {
+            m_Queue.cancel(m_ScheduledEvent);
+            m_ScheduledEvent = 0;
+        }
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::EnterState(const SensorState_t& state)
+    {
+        const auto previous = m_State.exchange(state);
+
+        if (previous != state)
+        {
+            m_Device.GetEventLog().template Record<DriverEvent_t::SENSOR_STATE_CHANGED>(
+                ToUnderlyingType(previous), ToUnderlyingType(state));
+
+            if (m_OnStateChange)
+            {
+                m_OnStateChange(state);
+            }
+        }
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::EnterNormal()
+    {
+        EnterState(SensorState_t::NORMAL);
+
+        if (IsDutyCycling())
+        {
+            m_BurstSweeps = 0;
+            m_Averager.Reset();
+            Schedule(MilliSecs_t(0), &SensorStateMachine::OnMonitoringTick);
+        }
+        else if (m_MonitoringPeriod > MilliSecs_t(0))
+        {
+            Schedule(m_MonitoringPeriod, &SensorStateMachine::OnMonitoringTick);
+        }
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::EnterRecovery(const std::error_code& cause)
+    {
+        CancelScheduled();
+        m_LastError = cause;
+
+        if (++m_RecoveryAttempts > MAXIMUM_RECOVERY_ATTEMPTS)
+        {
+            m_Device.GetEventLog().template Record<DriverEvent_t::SENSOR_RECOVERY_ABANDONED>(
+                cause.value(), MAXIMUM_RECOVERY_ATTEMPTS);
+
+            m_LastError = make_error_code(SensorStatus_t::ERROR_RECOVERY_ATTEMPTS_EXHAUSTED);
+            m_DutyCycle = DutyCycle_t{};
+            PowerDownSensor();
+            return;
+        }
+
+        m_Device.GetEventLog().template Record<DriverEvent_t::SENSOR_RECOVERY_STARTED>(
+            cause.value(), m_RecoveryAttempts);
+
+        EnterState(SensorState_t::RECOVERY);
+
+        // \" Software (SW) reset is done with SPI operation (see 5.1.4). \"
+        m_Device.SoftwareReset();
+        Schedule(RESET_SETTLING_TIME, &SensorStateMachine::OnRecoveryReset);
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::BeginStartup()
+    {
+        CancelScheduled();
+        ConcludeCycle(); // Should a cycle be restarted part-way.
+
+        m_RecoveryAttempts = 0;
+
+        if (IsDutyCycling())
+        {
+            m_CycleInProgress  = true;
+            m_CycleStartTime   = MonotonicClock_t::now();
+            m_CycleStartFrames = m_Device.GetSPIFrameCount();
+            ++m_DutyCycleStatistics.m_Cycles;
+        }
+
+        m_StartupStep = m_Device.IsPoweredDown() ? StartupStep_t::WAKE_UP
+                                                 : StartupStep_t::SOFTWARE_RESET;
+        EnterState(SensorState_t::STARTUP);
+        OnStartupStep();
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::PowerDownSensor()
+    {
+        m_Device.PowerDown();
+        ConcludeCycle();
+        EnterState(SensorState_t::POWER_DOWN);
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::ConcludeCycle()
+    {
+        if (m_CycleInProgress)
+        {
+            m_CycleInProgress = false;
+
+            m_DutyCycleStatistics.m_AwakeTime += std::chrono::duration_cast<MicroSecs_t>(
+                                                     MonotonicClock_t::now() - m_CycleStartTime);
+            m_DutyCycleStatistics.m_SPIFrames += (m_Device.GetSPIFrameCount() - m_CycleStartFrames);
+        }
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::ConcludeBurst()
+    {
+        DeliverAverage();
+        PowerDownSensor();
+
+        // Wake-ups keep to the nominal schedule, unless it has already
+        // slipped by a whole period.
+        const auto now = MonotonicClock_t::now();
+
+        m_NextWakeupTime += m_DutyCycle.m_Period;
+        if (m_NextWakeupTime <= now)
+        {
+            ++m_DutyCycleStatistics.m_Overruns;
+            m_NextWakeupTime = now;
+        }
+
+        Schedule(std::chrono::ceil<MilliSecs_t>(m_NextWakeupTime - now), &SensorStateMachine::BeginStartup);
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::DeliverAverage()
+    {
+        if (m_Averager.GetCount() > 0)
+        {
+            const auto sample = m_Averager.GetAverage();
+            m_Averager.Reset();
+
+            ++m_DutyCycleStatistics.m_SamplesDelivered;
+
+            if (m_OnSample)
+            {
+                m_OnSample(sample);
+            }
+        }
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::OnStartupStep()
+    {
+        // \" 4.2 Start-up sequence
+        //
+        // Table 11 Start-Up Sequence \"
+        switch (m_StartupStep)
+        {
+            case StartupStep_t::WAKE_UP:
+                // \" 1 Write Wake up from power down mode command. \"
+                m_Device.WakeupFromPowerDown();
+                m_StartupStep = StartupStep_t::SOFTWARE_RESET;
+                Schedule(WAKEUP_SETTLING_TIME, &SensorStateMachine::OnStartupStep);
+                break;
+
+            case StartupStep_t::SOFTWARE_RESET:
+                // \" 2 Write SW Reset command. Software reset the device \"
+                m_Device.SoftwareReset();
+                m_StartupStep = StartupStep_t::SET_MEASUREMENT_MODE;
+                Schedule(RESET_SETTLING_TIME, &SensorStateMachine::OnStartupStep);
+                break;
+
+            case StartupStep_t::SET_MEASUREMENT_MODE:
+            {
+                const auto result = m_Device.SetMeasurementMode();
+                if (result)
+                {
+                    EnterRecovery(result);
+                }
+                else
+                {
+                    // \" Settling of signal path. \" Mode 1: 25 ms, Mode 2:
+                    // 15 ms, Modes 3 and 4: 100 ms.
+                    const auto settlingTime = m_Device.GetModeProfile().m_SettlingTime;
+
+                    EnterState(SensorState_t::SETTLING);
+
+                    if (m_Device.GetStartupPolicy() == StartupPolicy_t::READINESS_POLLING)
+                    {
+                        m_SettlingDeadline = MonotonicClock_t::now() + settlingTime;
+                        Schedule(READINESS_POLL_INTERVAL, &SensorStateMachine::OnReadinessPoll);
+                    }
+                    else
+                    {
+                        Schedule(settlingTime, &SensorStateMachine::OnSettled);
+                    }
+                }
+                break;
+            }
+        }
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::OnSettled()
+    {
+        // STATUS latches the start-up and mode change indications; read
+        // it out so that only fresh flags are seen whilst Normal.
+        const auto result = m_Device.ConcludeStartupSettling();
+        if (result)
+        {
+            EnterRecovery(result);
+        }
+        else
+        {
+            m_ConsecutiveSweepFailures = 0;
+            EnterNormal();
+        }
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::OnReadinessPoll()
+    {
+        // RS '01' means settled, and with STATUS already cleared.
+        if (!m_Device.PollStartupReadiness())
+        {
+            m_ConsecutiveSweepFailures = 0;
+            EnterNormal();
+            return;
+        }
+
+        const auto now = MonotonicClock_t::now();
+
+        if ((now + READINESS_POLL_INTERVAL) < m_SettlingDeadline)
+        {
+            Schedule(READINESS_POLL_INTERVAL, &SensorStateMachine::OnReadinessPoll);
+        }
+        else
+        {
+            // Fall back to the datasheet bound.
+            const auto remaining = std::chrono::ceil<MilliSecs_t>(m_SettlingDeadline - now);
+            Schedule(std::max(remaining, MilliSecs_t(0)), &SensorStateMachine::OnSettled);
+        }
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::OnRecoveryReset()
+    {
+        // Resume the start-up sequence from \" 4 Set Measurement mode. \"
+        m_StartupStep = StartupStep_t::SET_MEASUREMENT_MODE;
+        EnterState(SensorState_t::STARTUP);
+        OnStartupStep();
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::OnMonitoringTick()
+    {
+        if (m_State == SensorState_t::NORMAL)
+        {
+            StartSweep();
+        }
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::StartSweep()
+    {
+        // DMA-backed where the target offers it; otherwise a synchronous
+        // pipelined sweep, which occupies the queue for some 100s of us.
+#if DEVICE_SPI_ASYNCH
+        m_SweepInFlight = true;
+
+        const auto result = m_Device.ReadAllSensorDataAsync(
+                                mbed::callback(this, &SensorStateMachine::OnTransferComplete));
+        if (result)
+        {
+            OnSweepComplete(result);
+        }
+#else
+        OnSweepComplete(m_Device.ReadAllSensorDataPipelined());
+#endif
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::OnTransferComplete(std::error_code result)
+    {
+        // Interrupt context; posting is the extent of it.
+        if (m_Queue.call([this, result] { OnSweepComplete(result); }) == 0)
+        {
+            RecordQueueExhausted();
+        }
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::OnSweepComplete(const std::error_code& result)
+    {
+        m_SweepInFlight = false;
+
+        if (m_State == SensorState_t::NORMAL)
+        {
+            const auto sample = m_Device.GetLatestSample();
+            const auto flags  = DecodeStatusSummary(sample.GetUnsigned(Channel_t::STATUS_SUMMARY));
+
+            // Flags are examined even should the sweep have failed; an
+            // active flag is precisely what turns the RS bits to '11'.
+            if (IsResetRequired(flags))
+            {
+                EnterRecovery(make_error_code(ToSensorStatus(flags)));
+            }
+            else if (result)
+            {
+                if (IsDutyCycling())
+                {
+                    ++m_DutyCycleStatistics.m_SweepsFailed;
+                }
+
+                if (++m_ConsecutiveSweepFailures >= MAXIMUM_CONSECUTIVE_SWEEP_FAILURES)
+                {
+                    EnterRecovery(result);
+                }
+            }
+            else
+            {
+                // A good sweep is the evidence that recovery, if any, worked.
+                m_ConsecutiveSweepFailures = 0;
+                m_RecoveryAttempts         = 0;
+
+                if (IsDutyCycling())
+                {
+                    ++m_DutyCycleStatistics.m_SweepsCompleted;
+
+                    m_Averager.Add(sample);
+                    if (m_Averager.GetCount() >= m_DutyCycle.m_AveragedSweeps)
+                    {
+                        DeliverAverage();
+                    }
+                }
+                else if (m_OnSample)
+                {
+                    m_OnSample(sample);
+                }
+            }
+
+            if (m_State == SensorState_t::NORMAL)
+            {
+                if (IsDutyCycling())
+                {
+                    // Failed sweeps count towards the burst too.
+                    if (++m_BurstSweeps < m_DutyCycle.m_BurstLength)
+                    {
+                        Schedule(m_DutyCycle.m_BurstSpacing, &SensorStateMachine::OnMonitoringTick);
+                    }
+                    else
+                    {
+                        ConcludeBurst();
+                    }
+                }
+                else if (m_MonitoringPeriod > MilliSecs_t(0))
+                {
+                    Schedule(m_MonitoringPeriod, &SensorStateMachine::OnMonitoringTick);
+                }
+            }
+        }
+        else if (m_State == SensorState_t::SELF_TEST)
+        {
+            // \" Component failure can be suspected if the STO signal
+            // exceeds the threshold level continuously... \"
+            ++m_SelfTestSweeps;
+            if (result || m_Device.GetSelfTestOutputErrorCode())
+            {
+                ++m_SelfTestFailures;
+            }
+
+            if (m_SelfTestSweeps < SELF_TEST_SWEEPS)
+            {
+                Schedule(SELF_TEST_SWEEP_SPACING, &SensorStateMachine::StartSweep);
+            }
+            else if ((2 * m_SelfTestFailures) > m_SelfTestSweeps) // Over 50% failure.
+            {
+                EnterRecovery(make_error_code(SensorStatus_t::ERROR_STO_SIGNAL_COMPONENT_FAILURE_DETECTED));
+            }
+            else
+            {
+                m_LastError = make_error_code(SensorStatus_t::SUCCESS);
+                EnterNormal();
+            }
+        }
+
+        if (m_DeferredRequest != Request_t::NONE)
+        {
+            const auto request = m_DeferredRequest;
+            m_DeferredRequest  = Request_t::NONE;
+
+            HandleRequest(request);
+        }
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::PrintDutyCycleStatistics() const
+    {
+        const auto& statistics = m_DutyCycleStatistics;
+        Formatting::TextBuffer_t<> buffer;
+
+        printf("\nDuty Cycle Statistics:\n");
+        printf("\tPeriod                  := [%lld ms]\n", static_cast<long long>(statistics.m_Period.count()));
+        printf("\tCycles                  := [%lu]\n", static_cast<unsigned long>(statistics.m_Cycles));
+        printf("\tOverruns                := [%lu]\n", static_cast<unsigned long>(statistics.m_Overruns));
+        printf("\tSweeps Completed        := [%lu]\n", static_cast<unsigned long>(statistics.m_SweepsCompleted));
+        printf("\tSweeps Failed           := [%lu]\n", static_cast<unsigned long>(statistics.m_SweepsFailed));
+        printf("\tSamples Delivered       := [%lu]\n", static_cast<unsigned long>(statistics.m_SamplesDelivered));
+        printf("\tAwake Time              := [%lld us]\n", static_cast<long long>(statistics.m_AwakeTime.count()));
+        printf("\tAwake Fraction          := [%s %%]\n", 
+            Formatting::FormatFixed(buffer, 100.0 * statistics.GetAwakeFraction(), 3).data());
+        printf("\tSPI Frames              := [%lu]\n", static_cast<unsigned long>(statistics.m_SPIFrames));
+        printf("\tSPI Bytes               := [%llu]\n", static_cast<unsigned long long>(statistics.GetSPIBytes()));
+        printf("\tSPI Frames per Sample   := [%s]\n", 
+            Formatting::FormatFixed(buffer, statistics.GetFramesPerSample(), 1).data());
+    }
+
+    template <typename Device_t, TimedEventQueue EventQueue_t>
+    void SensorStateMachine<Device_t, EventQueue_t>::RecordQueueExhausted()
+    {
+        m_Device.GetEventLog().template Record<DriverEvent_t::EVENT_QUEUE_EXHAUSTED>(
+            ToUnderlyingType(SensorStatus_t::ERROR_EVENT_QUEUE_EXHAUSTED));
+    }
+
+} // End of namespace Supervision.
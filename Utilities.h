@@ -31,17 +31,35 @@
 #include <algorithm>
 #include <functional>
 #include <optional>
-#include <iomanip>
-#include <ostream>
-#include <sstream>
 #include <map>
 #include <array>
 #include <tuple>
 #include <string>
 #include <chrono>
+
+#include "Formatting.h"
+#if defined(__MBED__)
 //#include "mbed_mem_trace.h"
 #include "mbed_events.h"   // thread and irq safe
 #include "mbed.h"
+#include "drivers/HighResClock.h"
+#else
+// Host (e.g. Linux developer workstation) builds of the protocol engine.
+// Only the handful of Mbed facilities the driver itself leans on are 
+// stood in for here.
+#include <thread>
+
+using namespace std::chrono_literals;
+
+namespace ThisThread
+{
+    template <typename Rep, typename Period>
+    void sleep_for(const std::chrono::duration<Rep, Period>& duration)
+    {
+        std::this_thread::sleep_for(duration);
+    }
+}
+#endif
     
 // These clocks should NOT be relied on in embedded systems. Rather, use the RTC. 
 using SystemClock_t         = std::chrono::system_clock;
@@ -113,6 +131,34 @@ namespace Utilities
     // and
     //
     // auto d = Utility::NucleoF767ZIClock_t::now() - t;  // a chrono::duration
+    //
+    // Note however that, being derived from time(NULL), it only ticks at
+    // a one second resolution. Use MonotonicClock_t below for anything
+    // finer, e.g. microsecond-level protocol timing.
+
+    // High-resolution monotonic clock with microsecond resolution. On 
+    // Mbed targets this is read from the HAL us_ticker (by way of 
+    // mbed::HighResClock), which is safe to read from interrupt context.
+    // Host builds fall back to std::chrono::steady_clock.
+    struct MonotonicClock_t
+    {
+        using rep        = std::int64_t;
+        using period     = std::micro;
+        using duration   = std::chrono::duration<rep, period>;
+        using time_point = std::chrono::time_point<MonotonicClock_t>;
+        static constexpr bool is_steady = true;
+
+        static time_point now() noexcept
+        {
+#if defined(__MBED__)
+            return time_point(std::chrono::duration_cast<duration>(
+                       mbed::HighResClock::now().time_since_epoch()));
+#else
+            return time_point(std::chrono::duration_cast<duration>(
+                       SteadyClock_t::now().time_since_epoch()));
+#endif
+        }
+    };
 
     // This custom clock type obtains the time from the 'chip-external' Real Time Clock (RTC).
     template <typename Clock_t = SystemClock_t>
@@ -173,32 +219,27 @@ namespace Utilities
         return result;
     }
     
+    // The std::string returning helpers below are retained for callers
+    // outside of the driver; the driver itself formats into fixed buffers
+    // by way of Formatting:: instead.
     template <typename T>
     constexpr auto TruncateAndToString = [](const T& x, const int& decimalDigits = 2)
     {
-        std::ostringstream oss;  
-        oss << std::fixed;
-        oss.precision(decimalDigits);
-        oss << x;
-        return oss.str();
+        Formatting::TextBuffer_t<> buffer;
+        return std::string(Formatting::FormatFixed(buffer, static_cast<double>(x), 
+                                                   static_cast<uint8_t>(decimalDigits)));
     };
     
     const auto TemperatureToString = [](const float& temperature)
     {
-        std::ostringstream oss;  
-        oss << std::fixed;
-        oss.precision(2);
-        oss << "Temp: " << temperature << " F";
-        return oss.str();
+        Formatting::TextBuffer_t<> buffer;
+        return std::string("Temp: ") + std::string(Formatting::FormatFixed(buffer, temperature)) + " F";
     };
     
     const auto HumidityToString = [](const float& humidity)
     {
-        std::ostringstream oss;  
-        oss << std::fixed;
-        oss.precision(2);
-        oss << "Humi: " << humidity << " % RH";
-        return oss.str();
+        Formatting::TextBuffer_t<> buffer;
+        return std::string("Humi: ") + std::string(Formatting::FormatFixed(buffer, humidity)) + " % RH";
     };
 
     template <typename E>
@@ -210,21 +251,15 @@ namespace Utilities
     template <typename T>
     std::string IntegerToHex(const T& i)
     {
-        std::stringstream stream;
-        stream << std::showbase << std::setfill('0') 
-               << std::setw(sizeof(T)*2) 
-               << std::hex 
-               << std::uppercase 
-               << i;
-        return stream.str();
+        Formatting::TextBuffer_t<> buffer;
+        return std::string(Formatting::FormatHex(buffer, i));
     }
 
     template <typename T>
     std::string IntegerToDec(const T& i)
     {
-        std::stringstream stream;
-        stream << std::dec << std::to_string(i);
-        return stream.str();
+        Formatting::TextBuffer_t<> buffer;
+        return std::string(Formatting::FormatInteger(buffer, i));
     }
 
 } //end of namespace
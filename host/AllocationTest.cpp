@@ -0,0 +1,133 @@
+/***********************************************************************
+* @file      AllocationTest.cpp
+*
+*    Host check that the acquisition, validation and conversion paths of
+*    the SCL3300 driver never touch the heap once started.
+*
+*    The global operator new/delete are replaced with counting versions
+*    (see AllocationGuard.h). The driver is then started against the
+*    SCL3300 simulator and driven through thousands of pipelined, subset,
+*    streamed, serial number and conversion cycles under an
+*    AllocationGuard.
+*
+* @brief   Exits non-zero should anything have been allocated, or should
+*          any read have failed.
+*
+* @note    Start-up itself may allocate (e.g. stdio buffers upon the first
+*          printf()); it is hence run, along with a warm-up cycle, before
+*          the guard is constructed.
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#define SCL3300_DEFINE_ALLOCATION_HOOKS
+#define SCL3300_ZERO_HEAP
+
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+
+#include "NuerteySCL3300Device.h"
+#include "SCL3300Simulator.h"
+#include "AllocationGuard.h"
+
+using namespace Simulation;
+
+using HostDevice_t = NuerteySCL3300Device<InMemorySPITransport<SCL3300Simulator<>>>;
+
+constexpr uint32_t NUMBER_OF_CYCLES = 5000;
+
+// The three angles; i.e. four frames per sweep.
+constexpr ChannelSet_t ANGLE_CHANNELS = MakeChannelSet(Channel_t::ANGLE_X_AXIS,
+                                                      Channel_t::ANGLE_Y_AXIS,
+                                                      Channel_t::ANGLE_Z_AXIS);
+
+// One acquisition cycle exercising every heap-free path. Returns the
+// number of failed operations.
+uint32_t RunCycle(HostDevice_t& device)
+{
+    uint32_t failures = 0;
+
+    auto tally = [&failures](const std::error_code& result)
+    {
+        if (result)
+        {
+            ++failures;
+        }
+    };
+
+    tally(device.ReadAllSensorDataPipelined());
+    tally(device.ReadChannelsPipelined(ANGLE_CHANNELS));
+    tally(device.ReadChannels<Channel_t::ACCELERATION_X_AXIS,
+                              Channel_t::ACCELERATION_Y_AXIS,
+                              Channel_t::ACCELERATION_Z_AXIS>());
+
+    int16_t streamed{};
+    for (int index = 0; index < 4; ++index)
+    {
+        tally(device.StreamChannel<Channel_t::ANGLE_X_AXIS>(streamed));
+    }
+
+    SerialNumber_t serialNumber{};
+    tally(device.ReadSerialNumber(serialNumber));
+
+    // Conversions, both scalar and batched.
+    const auto sample      = device.GetLatestSample();
+    const auto fixedPoint  = device.GetLatestFixedPointSample();
+    volatile double sink   = device.GetAngleXAxis() + device.GetAccelerationZAxis()
+                           + device.GetTemperature<Celsius_t>() + fixedPoint.m_AngleCentiDegrees[0];
+
+    std::array<float, NUMBER_OF_CHANNELS>          floats{};
+    std::array<CentiDegrees_t, NUMBER_OF_CHANNELS> centiDegrees{};
+    std::array<MilliG_t, NUMBER_OF_CHANNELS>       milliG{};
+
+    ConvertAngles(sample.m_Raw, floats);
+    ConvertAngles(sample.m_Raw, centiDegrees);
+    ConvertAccelerations(sample.m_Raw, milliG, GetScaleFactors(device.GetInclinometerMode()));
+    ConvertTemperatures(sample.m_Raw, floats);
+    sink = sink + floats[0] + centiDegrees[0] + milliG[0];
+
+    // Diagnostics are deferred into a fixed ring; draining it must not
+    // allocate either.
+    device.GetEventLog().Drain([](std::span<const Diagnostics::LogEvent_t>) {});
+
+    return failures;
+}
+
+int main()
+{
+    HostDevice_t device(std::in_place, 0, 0, 8, 4'000'000,
+                        SCL3300Simulator<>(Waveforms::Noise(Waveforms::Tilt(30.0, -10.0), 0.001)));
+
+    device.LaunchStartupSequence();
+
+    uint32_t failures = RunCycle(device);
+
+    Diagnostics::AllocationGuard allocationGuard;
+
+    for (uint32_t cycle = 0; cycle < NUMBER_OF_CYCLES; ++cycle)
+    {
+        failures += RunCycle(device);
+    }
+
+    const auto allocations    = allocationGuard.GetAllocations();
+    const auto allocatedBytes = allocationGuard.GetAllocatedBytes();
+
+    printf("\n%lu cycles: [%lu] allocations, [%lu] bytes, [%lu] failed reads.\n",
+        static_cast<unsigned long>(NUMBER_OF_CYCLES),
+        static_cast<unsigned long>(allocations),
+        static_cast<unsigned long>(allocatedBytes),
+        static_cast<unsigned long>(failures));
+
+    if (!allocationGuard.IsClean() || (failures != 0))
+    {
+        printf("FAILED\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("PASSED\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,146 @@
+/***********************************************************************
+* @file      BusSchedulerTest.cpp
+*
+*    Host check that the BusScheduler interleaves the frame trains of
+*    four SCL3300s sharing one bus, without any device ever seeing its
+*    own frames closer together than the 10 us inter-frame gap.
+*
+*    Each simulated device sits behind its own transport, which honours
+*    the gap (as mbed::SPI would) and appends the device's index to one
+*    bus-wide trace per frame. The simulators themselves count any frame
+*    arriving within 10 us of their previous one as a gap violation.
+*
+* @brief   Exits non-zero should any sweep fail, any gap be violated, or
+*          the trace show the trains run back-to-back rather than
+*          interleaved.
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+
+#include "BusScheduler.h"
+#include "SCL3300Simulator.h"
+
+using namespace Simulation;
+
+constexpr std::size_t NUMBER_OF_DEVICES = 4;
+constexpr uint32_t    NUMBER_OF_SWEEPS  = 100;
+
+// Every sweep of ALL_CHANNELS is one train of N+1 frames per device.
+constexpr std::size_t FRAMES_PER_SWEEP  = NUMBER_OF_DEVICES * (NUMBER_OF_CHANNELS + 1);
+
+// Device index of each frame clocked on the shared bus, in bus order.
+std::array<uint8_t, NUMBER_OF_SWEEPS * FRAMES_PER_SWEEP> g_BusTrace{};
+std::size_t                                           g_BusTraceLength = 0;
+bool                                                  g_IsTracing      = false;
+
+// As the sensor's own bus would be; i.e. the driver must honour the gap.
+class SharedBusTransport_t : public InMemorySPITransport<SCL3300Simulator<>>
+{
+public:
+    static constexpr bool REQUIRES_INTER_FRAME_GAP = true;
+
+    SharedBusTransport_t(const uint8_t& index, SCL3300Simulator<> simulator)
+        : InMemorySPITransport<SCL3300Simulator<>>(std::move(simulator))
+        , m_Index(index)
+    {
+    }
+
+    int write(const char* txBuffer, int txLength, char* rxBuffer, int rxLength)
+    {
+        if (g_IsTracing && (g_BusTraceLength < g_BusTrace.size()))
+        {
+            g_BusTrace[g_BusTraceLength++] = m_Index;
+        }
+
+        return InMemorySPITransport<SCL3300Simulator<>>::write(txBuffer, txLength, rxBuffer, rxLength);
+    }
+
+private:
+    uint8_t m_Index;
+};
+
+using HostDevice_t = NuerteySCL3300Device<SharedBusTransport_t>;
+
+int main()
+{
+    HostDevice_t sensor0(std::in_place, 0, 0, 8, 4'000'000, 0, SCL3300Simulator<>(Waveforms::Tilt(10.0, -5.0)));
+    HostDevice_t sensor1(std::in_place, 0, 0, 8, 4'000'000, 1, SCL3300Simulator<>(Waveforms::Tilt(20.0, -10.0)));
+    HostDevice_t sensor2(std::in_place, 0, 0, 8, 4'000'000, 2, SCL3300Simulator<>(Waveforms::Tilt(30.0, -15.0)));
+    HostDevice_t sensor3(std::in_place, 0, 0, 8, 4'000'000, 3, SCL3300Simulator<>(Waveforms::Tilt(40.0, -20.0)));
+
+    sensor0.LaunchStartupSequence();
+    sensor1.LaunchStartupSequence();
+    sensor2.LaunchStartupSequence();
+    sensor3.LaunchStartupSequence();
+
+    Acquisition::BusScheduler scheduler(sensor0, sensor1, sensor2, sensor3);
+
+    std::array<std::error_code, NUMBER_OF_DEVICES> results{};
+    uint32_t failedSweeps = 0;
+
+    g_IsTracing = true;
+
+    for (uint32_t sweep = 0; sweep < NUMBER_OF_SWEEPS; ++sweep)
+    {
+        if (scheduler.Sweep(ALL_CHANNELS, results))
+        {
+            ++failedSweeps;
+        }
+    }
+
+    g_IsTracing = false;
+
+    uint64_t gapViolations = 0;
+    for (std::size_t index = 0; index < NUMBER_OF_DEVICES; ++index)
+    {
+        gapViolations += scheduler.GetDevice(index).GetTransport().GetResponder().GetGapViolations();
+    }
+
+    // Consecutive frames on the bus addressed to different devices. Run
+    // back-to-back, four trains would hand the bus over just three times
+    // per sweep; interleaved, almost every frame is a hand-over.
+    std::size_t handOvers = 0;
+    std::array<std::size_t, NUMBER_OF_DEVICES> framesPerDevice{};
+
+    for (std::size_t frame = 0; frame < g_BusTraceLength; ++frame)
+    {
+        ++framesPerDevice[g_BusTrace[frame]];
+
+        if ((frame > 0) && (g_BusTrace[frame] != g_BusTrace[frame - 1]))
+        {
+            ++handOvers;
+        }
+    }
+
+    scheduler.PrintStatistics();
+
+    printf("\n%lu sweeps: [%lu] failed, [%lu] frames, [%lu] hand-overs, [%lu] gap violations.\n",
+        static_cast<unsigned long>(NUMBER_OF_SWEEPS),
+        static_cast<unsigned long>(failedSweeps),
+        static_cast<unsigned long>(g_BusTraceLength),
+        static_cast<unsigned long>(handOvers),
+        static_cast<unsigned long>(gapViolations));
+
+    bool isBalanced = true;
+    for (const auto& frames : framesPerDevice)
+    {
+        isBalanced = isBalanced && (frames == (NUMBER_OF_SWEEPS * (NUMBER_OF_CHANNELS + 1)));
+    }
+
+    if ((failedSweeps != 0) || (gapViolations != 0) || !isBalanced
+        || (g_BusTraceLength != g_BusTrace.size()) || ((2 * handOvers) < g_BusTraceLength))
+    {
+        printf("FAILED\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("PASSED\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,102 @@
+/***********************************************************************
+* @file      CRCBenchmark.cpp
+*
+*    Micro-benchmark of the table-driven SPI frame CRC engine against
+*    the datasheet's bit-serial routine, CalculateCRCBitwise().
+*
+*    Both are first checked to agree over every possible 24-bit frame
+*    payload. Each is then timed over the same stream of frames, the
+*    results being folded into a volatile so that neither loop can be
+*    optimized away.
+*
+* @brief   Exits non-zero should the engines disagree on any frame.
+*          Pass --check-only to skip the timings; ctest does so.
+*
+* @note    Build optimized (the host CMakeLists.txt defaults to Release);
+*          timings are per frame, and vary with the host of course.
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+
+#include "Protocol.h"
+
+using namespace ProtocolDefinitions;
+
+constexpr uint32_t NUMBER_OF_PAYLOADS   = (1UL << 24);
+constexpr uint32_t NUMBER_OF_ITERATIONS = 50'000'000;
+
+// Varies the payload from frame to frame, so that the table lookups are
+// not all served by the same few cache lines.
+constexpr SPICommandFrame_t MakeFrame(const uint32_t& payload)
+{
+    return SPICommandFrame_t{static_cast<uint8_t>(payload >> 16),
+                             static_cast<uint8_t>(payload >> 8),
+                             static_cast<uint8_t>(payload),
+                             0x00};
+}
+
+template <typename F>
+double MeasureNanoSecsPerFrame(F&& crc)
+{
+    volatile uint8_t sink = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t iteration = 0; iteration < NUMBER_OF_ITERATIONS; ++iteration)
+    {
+        sink = sink ^ crc(MakeFrame(iteration * 2654435761UL));
+    }
+
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    return (elapsed.count() / NUMBER_OF_ITERATIONS);
+}
+
+int main(int argc, char* argv[])
+{
+    const bool isCheckOnly = ((argc > 1) && (std::strcmp(argv[1], "--check-only") == 0));
+
+    uint32_t mismatches = 0;
+
+    for (uint32_t payload = 0; payload < NUMBER_OF_PAYLOADS; ++payload)
+    {
+        const auto frame = MakeFrame(payload);
+        if (CalculateCRC(frame) != CalculateCRCBitwise(frame))
+        {
+            ++mismatches;
+        }
+    }
+
+    printf("CRC engines disagree on [%lu] of [%lu] frame payloads.\n",
+        static_cast<unsigned long>(mismatches), static_cast<unsigned long>(NUMBER_OF_PAYLOADS));
+
+    if (isCheckOnly)
+    {
+        return (mismatches == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    const auto bitwise = MeasureNanoSecsPerFrame([](const SPICommandFrame_t& frame)
+                                                 { return CalculateCRCBitwise(frame); });
+    const auto table   = MeasureNanoSecsPerFrame([](const SPICommandFrame_t& frame)
+                                                 { return CalculateCRC(frame); });
+
+    printf("\tCalculateCRCBitwise() := [%.2f ns/frame]\n", bitwise);
+    printf("\tCalculateCRC()        := [%.2f ns/frame]", table);
+#if defined(SCL3300_CRC_NIBBLE_TABLE)
+    printf(" (nibble table)\n");
+#else
+    printf(" (byte table)\n");
+#endif
+    printf("\tSpeed-up              := [%.1fx]\n", bitwise / table);
+
+    return (mismatches == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
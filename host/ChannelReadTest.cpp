@@ -0,0 +1,66 @@
+/***********************************************************************
+* @file      ChannelReadTest.cpp
+*
+*    Host check of the SPI frame cost of compile-time channel subset
+*    reads against the simulator: N registers of bank #0 are to be read
+*    in N+1 frames, whether through ReadChannels<...>() or the pipelined
+*    sweep of every channel.
+*
+* @brief   Exits non-zero should the three angles take other than 4
+*          frames, the full sweep other than 11, or any read fail.
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+
+#include "NuerteySCL3300Device.h"
+#include "SCL3300Simulator.h"
+
+using namespace Simulation;
+
+using HostDevice_t = FixedModeSCL3300Device<OperationMode_t::MODE_4, InMemorySPITransport<SCL3300Simulator<>>>;
+
+constexpr ChannelList_t<Channel_t::ANGLE_X_AXIS,
+                        Channel_t::ANGLE_Y_AXIS,
+                        Channel_t::ANGLE_Z_AXIS> LEVELING_CHANNELS{};
+
+constexpr uint64_t EXPECTED_LEVELING_FRAMES = 3 + 1;
+constexpr uint64_t EXPECTED_SWEEP_FRAMES    = NUMBER_OF_CHANNELS + 1;
+
+int main()
+{
+    HostDevice_t device(std::in_place, 0, 0, 8, 4'000'000,
+                        SCL3300Simulator<>(Waveforms::Tilt(30.0, -10.0)));
+
+    device.LaunchStartupSequence();
+
+    const auto& simulator = device.GetTransport().GetResponder();
+
+    const auto beforeLeveling = simulator.GetFrameCount();
+    const auto levelingResult = device.ReadChannels(LEVELING_CHANNELS);
+    const auto levelingFrames = simulator.GetFrameCount() - beforeLeveling;
+
+    const auto beforeSweep = simulator.GetFrameCount();
+    const auto sweepResult = device.ReadChannelsPipelined(ALL_CHANNELS);
+    const auto sweepFrames = simulator.GetFrameCount() - beforeSweep;
+
+    printf("\nThree angles: [%llu] frames (%s); every channel: [%llu] frames (%s).\n",
+        static_cast<unsigned long long>(levelingFrames), levelingResult.message().c_str(),
+        static_cast<unsigned long long>(sweepFrames), sweepResult.message().c_str());
+
+    if (levelingResult || sweepResult
+        || (levelingFrames != EXPECTED_LEVELING_FRAMES) || (sweepFrames != EXPECTED_SWEEP_FRAMES))
+    {
+        printf("FAILED\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("PASSED\n");
+    return EXIT_SUCCESS;
+}
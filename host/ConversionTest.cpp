@@ -0,0 +1,76 @@
+/***********************************************************************
+* @file      ConversionTest.cpp
+*
+*    Exhaustive check of the integer (Q-format) conversions against the
+*    datasheet formulae evaluated in double precision, over every
+*    possible 16-bit register value and, for accelerations, in every
+*    measurement mode.
+*
+* @brief   Exits non-zero should any conversion stray by more than one
+*          unit (mg, centi-degree or centi-degree Celsius) from the exact
+*          result.
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+
+#include "Conversions.h"
+
+using namespace Conversions;
+
+constexpr double TOLERANCE = 1.0;
+
+int main()
+{
+    double worstMilliG                 = 0.0;
+    double worstCentiDegrees           = 0.0;
+    double worstNormalizedCentiDegrees = 0.0;
+    double worstCentiCelsius           = 0.0;
+
+    for (int32_t value = INT16_MIN; value <= INT16_MAX; ++value)
+    {
+        const auto raw = static_cast<int16_t>(value);
+
+        for (const auto mode : {OperationMode_t::MODE_1, OperationMode_t::MODE_2,
+                                OperationMode_t::MODE_3, OperationMode_t::MODE_4})
+        {
+            const auto& factors = GetScaleFactors(mode);
+            const double exact  = (raw * 1000.0) / factors.m_AccelerationLSBPerG;
+
+            worstMilliG = std::max(worstMilliG, std::fabs(ToMilliG(raw, factors) - exact));
+        }
+
+        // \" Angle [°] = d'ANG_% / 2^14 * 90 \"
+        const double angle = (raw * 9000.0) / 16384.0;
+        worstCentiDegrees = std::max(worstCentiDegrees, std::fabs(ToCentiDegrees(raw) - angle));
+
+        const double normalizedAngle = (angle < 0.0) ? (angle + 36000.0) : angle;
+        worstNormalizedCentiDegrees = std::max(worstNormalizedCentiDegrees,
+                                               std::fabs(ToNormalizedCentiDegrees(raw) - normalizedAngle));
+
+        // \" Temperature [°C] = -273 + (TEMP / 18.9) \"
+        const double temperature = -27300.0 + ((raw * 100.0) / 18.9);
+        worstCentiCelsius = std::max(worstCentiCelsius, std::fabs(ToCentiCelsius(raw) - temperature));
+    }
+
+    printf("\nWorst-case errors: [%f mg], [%f cdeg], [%f cdeg normalized], [%f cC].\n",
+        worstMilliG, worstCentiDegrees, worstNormalizedCentiDegrees, worstCentiCelsius);
+
+    if ((worstMilliG > TOLERANCE) || (worstCentiDegrees > TOLERANCE)
+        || (worstNormalizedCentiDegrees > TOLERANCE) || (worstCentiCelsius > TOLERANCE))
+    {
+        printf("FAILED\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("PASSED\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,146 @@
+/***********************************************************************
+* @file      DutyCycleTest.cpp
+*
+*    Host check of duty-cycled acquisition by the SensorStateMachine
+*    against the simulator: a 500 ms period, with a burst of 8 sweeps
+*    averaged 4 at a time, for a little over 2 s.
+*
+*    The state machine is driven by a minimal single-threaded stand-in
+*    for events::EventQueue, which dispatches its events in due order and
+*    sleeps in between; the device's own waits being in real time.
+*
+* @brief   Exits non-zero should a cycle overrun, a sweep fail, a burst
+*          deliver other than its 2 averages, the sensor be awake for
+*          most of the time, or fail to power down when asked.
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#include <map>
+#include <thread>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <functional>
+
+#include "SensorStateMachine.h"
+#include "SCL3300Simulator.h"
+
+using namespace Simulation;
+using namespace Supervision;
+
+using HostDevice_t = NuerteySCL3300Device<InMemorySPITransport<SCL3300Simulator<>>>;
+
+// Satisfies TimedEventQueue. Time is in milliseconds since construction.
+class ManualEventQueue
+{
+public:
+    template <typename F>
+    int call(F event)
+    {
+        return call_in(MilliSecs_t(0), std::move(event));
+    }
+
+    template <typename F>
+    int call_in(const MilliSecs_t& delay, F event)
+    {
+        m_Events.emplace(m_Now + delay, Event_t{m_NextId, std::function<void()>(std::move(event))});
+        return m_NextId++;
+    }
+
+    bool cancel(const int& id)
+    {
+        for (auto iterator = m_Events.begin(); iterator != m_Events.end(); ++iterator)
+        {
+            if (iterator->second.m_Id == id)
+            {
+                m_Events.erase(iterator);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void DispatchUntil(const MilliSecs_t& end)
+    {
+        while (!m_Events.empty() && (m_Events.begin()->first <= end))
+        {
+            const auto iterator = m_Events.begin();
+            auto       event    = std::move(iterator->second.m_Callback);
+
+            std::this_thread::sleep_for(iterator->first - m_Now);
+            m_Now = iterator->first;
+            m_Events.erase(iterator);
+
+            event();
+        }
+
+        std::this_thread::sleep_for(end - m_Now);
+        m_Now = end;
+    }
+
+private:
+    struct Event_t
+    {
+        int                   m_Id;
+        std::function<void()> m_Callback;
+    };
+
+    MilliSecs_t                         m_Now{0};
+    int                                 m_NextId{1};
+    std::multimap<MilliSecs_t, Event_t> m_Events;
+};
+
+static_assert(TimedEventQueue<ManualEventQueue>);
+
+constexpr DutyCycle_t DUTY_CYCLE{MilliSecs_t(500), 8, 4, MilliSecs_t(1)};
+
+int main()
+{
+    SimulatorTimings_t timings;
+    timings.m_Mode3And4SettlingTime = MicroSecs_t(40000);
+
+    HostDevice_t device(std::in_place, 0, 0, 8, 4'000'000,
+                        SCL3300Simulator<>(Waveforms::Tilt(30.0, -10.0), timings));
+    device.SetStartupPolicy(StartupPolicy_t::READINESS_POLLING);
+
+    ManualEventQueue   queue;
+    SensorStateMachine stateMachine(device, queue);
+
+    uint32_t samplesHandled = 0;
+
+    stateMachine.Configure(MilliSecs_t(0), {},
+                           [&samplesHandled](const SCL3300Sample_t&) { ++samplesHandled; });
+
+    auto result = stateMachine.StartDutyCycle(DUTY_CYCLE);
+
+    queue.DispatchUntil(MilliSecs_t(2100));
+
+    stateMachine.RequestPowerDown();
+    queue.DispatchUntil(MilliSecs_t(2200));
+
+    const auto& statistics = stateMachine.GetDutyCycleStatistics();
+    stateMachine.PrintDutyCycleStatistics();
+
+    const auto expectedSamples = statistics.m_Cycles * (DUTY_CYCLE.m_BurstLength / DUTY_CYCLE.m_AveragedSweeps);
+
+    printf("\n[%lu] samples handled, [%lu] expected; sensor %s.\n",
+        static_cast<unsigned long>(samplesHandled),
+        static_cast<unsigned long>(expectedSamples),
+        device.IsPoweredDown() ? "powered down" : "still awake");
+
+    if (result || (statistics.m_Cycles < 4) || (statistics.m_Overruns != 0)
+        || (statistics.m_SweepsFailed != 0) || (statistics.m_SamplesDelivered != expectedSamples)
+        || (samplesHandled != expectedSamples) || (statistics.GetAwakeFraction() > 0.5)
+        || !device.IsPoweredDown())
+    {
+        printf("FAILED\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("PASSED\n");
+    return EXIT_SUCCESS;
+}
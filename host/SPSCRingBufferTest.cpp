@@ -0,0 +1,131 @@
+/***********************************************************************
+* @file      SPSCRingBufferTest.cpp
+*
+*    Producer/consumer stress test of SPSCRingBuffer, built (see the host
+*    CMakeLists.txt) with ThreadSanitizer so that any data race between
+*    the two sides is reported.
+*
+*    The producer pushes a numbered sequence of elements, retrying
+*    whenever the ring is full. Each element repeats its sequence number
+*    throughout its payload, so that torn reads show up. The consumer
+*    alternates between PopBatch() and the zero-copy Drain().
+*
+* @brief   Exits non-zero should any element be lost, duplicated,
+*          reordered or torn (or, under TSan, should a race be found).
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#include <span>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+
+#include "SPSCRingBuffer.h"
+
+constexpr uint64_t NUMBER_OF_ELEMENTS = 1'000'000;
+
+// About the size of an SCL3300Sample_t.
+struct Element_t
+{
+    std::array<uint64_t, 6> m_Payload;
+};
+
+Utilities::SPSCRingBuffer<Element_t, 64> g_Ring;
+
+int main()
+{
+    std::thread producer([]()
+    {
+        for (uint64_t sequence = 0; sequence < NUMBER_OF_ELEMENTS; )
+        {
+            Element_t element;
+            element.m_Payload.fill(sequence);
+
+            if (g_Ring.TryPush(element))
+            {
+                ++sequence;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint64_t expected  = 0;
+    uint64_t corrupted = 0;
+
+    auto check = [&expected, &corrupted](const Element_t& element)
+    {
+        for (const auto& word : element.m_Payload)
+        {
+            if (word != expected)
+            {
+                ++corrupted;
+                break;
+            }
+        }
+        ++expected;
+    };
+
+    std::array<Element_t, 16> batch{};
+    bool isBatched = true;
+
+    while (expected < NUMBER_OF_ELEMENTS)
+    {
+        std::size_t count = 0;
+
+        if (isBatched)
+        {
+            count = g_Ring.PopBatch(batch);
+            for (std::size_t index = 0; index < count; ++index)
+            {
+                check(batch[index]);
+            }
+        }
+        else
+        {
+            count = g_Ring.Drain([&check](std::span<const Element_t> run)
+            {
+                for (const auto& element : run)
+                {
+                    check(element);
+                }
+            });
+        }
+
+        isBatched = !isBatched;
+
+        if (count == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+
+    // Everything pushed has been popped; nothing may remain.
+    const auto leftOver = g_Ring.PopBatch(batch);
+
+    printf("\n[%llu] elements: [%llu] corrupted or out of order, [%lu] overruns, [%llu] left over.\n",
+        static_cast<unsigned long long>(expected),
+        static_cast<unsigned long long>(corrupted),
+        static_cast<unsigned long>(g_Ring.GetOverruns()),
+        static_cast<unsigned long long>(leftOver));
+
+    if ((corrupted != 0) || (expected != NUMBER_OF_ELEMENTS) || (leftOver != 0))
+    {
+        printf("FAILED\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("PASSED\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,223 @@
+/***********************************************************************
+* @file      SimulatorTest.cpp
+*
+*    Deterministic checks of the SCL3300 simulator itself, so that the
+*    driver's host checks rest upon a simulator known to model the
+*    datasheet behaviour they depend upon:
+*
+*    - RS '00' throughout start-up, then '11' (STATUS flagged by the
+*      reset), then '01' once STATUS has been read.
+*    - The 10 us inter-frame gap, to the microsecond.
+*    - SELBANK switching, and the registers of either bank.
+*    - STATUS and ERR_FLAG1 being cleared by reading them.
+*    - The LSB/g sensitivity of each of the four modes.
+*    - Frames with a wrong CRC being answered with RS '11' and discarded.
+*
+*    The simulator runs upon VirtualClock_t and is driven frame by frame;
+*    i.e. without the transport, so that each response is that of the
+*    very request just sent.
+*
+* @brief   Exits non-zero should any check fail.
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+
+#include "SCL3300Simulator.h"
+
+using namespace Simulation;
+
+using Simulator_t = SCL3300Simulator<VirtualClock_t>;
+
+constexpr MicroSecs_t INTER_FRAME_GAP{10};
+
+uint32_t g_Failures = 0;
+
+void Expect(const bool& condition, const char* description)
+{
+    if (!condition)
+    {
+        printf("\tFailed: %s\n", description);
+        ++g_Failures;
+    }
+}
+
+struct Response_t
+{
+    ReturnStatus_t m_ReturnStatus;
+    uint16_t       m_Value;
+};
+
+// Honours the inter-frame gap, then answers 'request'.
+Response_t Transfer(Simulator_t& simulator, const SPICommandFrame_t& request)
+{
+    VirtualClock_t::Advance(INTER_FRAME_GAP);
+
+    const auto response = simulator(request);
+
+    return {static_cast<ReturnStatus_t>(response[0] & 0x03),
+            static_cast<uint16_t>((response[1] << 8) | response[2])};
+}
+
+void CheckStartup()
+{
+    SimulatorTimings_t timings;
+    Simulator_t        simulator(Waveforms::Level(), timings);
+
+    const auto readyAfter = timings.m_ResetTime + timings.m_Mode1SettlingTime;
+
+    // WHOAMI rather than STATUS, which reading would clear.
+    Expect(Transfer(simulator, READ_WHO_AM_I).m_ReturnStatus == ReturnStatus_t::STARTUP_IN_PROGRESS,
+           "RS '00' upon power-up");
+
+    // To the microsecond, less the gaps which Transfer() adds.
+    VirtualClock_t::Advance(readyAfter - (3 * INTER_FRAME_GAP));
+    Expect(Transfer(simulator, READ_WHO_AM_I).m_ReturnStatus == ReturnStatus_t::STARTUP_IN_PROGRESS,
+           "RS '00' until start-up completes");
+
+    const auto flagged = Transfer(simulator, READ_STATUS_SUMMARY);
+    Expect(flagged.m_ReturnStatus == ReturnStatus_t::ERROR, "RS '11' once started, STATUS being flagged");
+    Expect(flagged.m_Value == STATUS_MODE_CHANGED, "STATUS flags the reset");
+
+    Expect(Transfer(simulator, READ_STATUS_SUMMARY).m_ReturnStatus == ReturnStatus_t::NORMAL_OPERATION_NO_FLAGS,
+           "RS '01' once STATUS has been read");
+
+    Expect(simulator.GetStartupLatency() == readyAfter, "Start-up latency as per the timings");
+}
+
+void CheckInterFrameGap()
+{
+    Simulator_t simulator;
+
+    simulator(READ_WHO_AM_I);
+
+    VirtualClock_t::Advance(INTER_FRAME_GAP - MicroSecs_t(1));
+    simulator(READ_WHO_AM_I);
+    Expect(simulator.GetGapViolations() == 1, "A 9 us gap is a violation");
+
+    VirtualClock_t::Advance(INTER_FRAME_GAP);
+    simulator(READ_WHO_AM_I);
+    Expect(simulator.GetGapViolations() == 1, "A 10 us gap is not");
+}
+
+void CheckMemoryBanks()
+{
+    constexpr uint32_t SERIAL_NUMBER = 0x0012D687;
+
+    Simulator_t simulator(Waveforms::Level(), SimulatorTimings_t(), SERIAL_NUMBER);
+    VirtualClock_t::Advance(MicroSecs_t(100000));
+
+    Expect(Transfer(simulator, READ_CURRENT_BANK).m_Value == 0, "Bank #0 upon reset");
+    Expect(Transfer(simulator, READ_WHO_AM_I).m_Value == WHO_AM_I, "WHOAMI in bank #0");
+
+    Transfer(simulator, SWITCH_TO_BANK_1);
+    Expect(simulator.GetActiveBank() == MemoryBank_t::BANK_1, "SELBANK selects bank #1");
+    Expect(Transfer(simulator, READ_CURRENT_BANK).m_Value == 1, "SELBANK reads back bank #1");
+    Expect(Transfer(simulator, READ_SERIAL_1).m_Value == (SERIAL_NUMBER & 0xFFFF), "SERIAL1 in bank #1");
+    Expect(Transfer(simulator, READ_SERIAL_2).m_Value == (SERIAL_NUMBER >> 16), "SERIAL2 in bank #1");
+    Expect(Transfer(simulator, READ_WHO_AM_I).m_Value == 0, "No WHOAMI in bank #1");
+
+    Transfer(simulator, CHANGE_TO_MODE_2);
+    Expect(simulator.GetMode() == OperationMode_t::MODE_1, "MODE is not writable from bank #1");
+
+    Transfer(simulator, SWITCH_TO_BANK_0);
+    Expect(simulator.GetActiveBank() == MemoryBank_t::BANK_0, "SELBANK selects bank #0");
+    Expect(Transfer(simulator, READ_SERIAL_1).m_Value == 0, "No SERIAL1 in bank #0");
+}
+
+void CheckStatusClearOnRead()
+{
+    Simulator_t simulator;
+    VirtualClock_t::Advance(MicroSecs_t(100000));
+
+    // That of the reset.
+    Transfer(simulator, READ_STATUS_SUMMARY);
+
+    simulator.InjectFault(STATUS_PIN_CONTINUITY, 0x0010);
+
+    const auto flagged = Transfer(simulator, READ_STATUS_SUMMARY);
+    Expect(flagged.m_ReturnStatus == ReturnStatus_t::ERROR, "RS '11' whilst a fault is latched");
+    Expect(flagged.m_Value == STATUS_PIN_CONTINUITY, "STATUS reports the fault");
+
+    const auto cleared = Transfer(simulator, READ_STATUS_SUMMARY);
+    Expect(cleared.m_ReturnStatus == ReturnStatus_t::NORMAL_OPERATION_NO_FLAGS, "RS '01' once STATUS was read");
+    Expect(cleared.m_Value == 0, "STATUS is cleared by reading it");
+
+    Expect(Transfer(simulator, READ_ERROR_FLAG_1).m_Value == 0x0010, "ERR_FLAG1 reports the fault");
+    Expect(Transfer(simulator, READ_ERROR_FLAG_1).m_Value == 0, "ERR_FLAG1 is cleared by reading it");
+}
+
+void CheckModeSensitivities()
+{
+    struct ModeSensitivity_t
+    {
+        SPICommandFrame_t m_Command;
+        OperationMode_t   m_Mode;
+        int16_t           m_LSBPerG;
+    };
+
+    // \" 6000 LSB/g ... 3000 LSB/g ... 12000 LSB/g \"
+    constexpr std::array<ModeSensitivity_t, 4> MODES{{
+        {CHANGE_TO_MODE_1, OperationMode_t::MODE_1, 6000},
+        {CHANGE_TO_MODE_2, OperationMode_t::MODE_2, 3000},
+        {CHANGE_TO_MODE_3, OperationMode_t::MODE_3, 12000},
+        {CHANGE_TO_MODE_4, OperationMode_t::MODE_4, 12000}}};
+
+    // +1g upon Z only.
+    Simulator_t simulator(Waveforms::Level());
+
+    for (const auto& mode : MODES)
+    {
+        Transfer(simulator, mode.m_Command);
+
+        // Past the settling time, and hence upon a fresh output sample.
+        VirtualClock_t::Advance(MicroSecs_t(200000));
+
+        Expect(simulator.GetMode() == mode.m_Mode, "The mode change is applied");
+        Expect(static_cast<int16_t>(Transfer(simulator, READ_ACCELERATION_Z_AXIS).m_Value) == mode.m_LSBPerG,
+               "1g reads as the mode's LSB/g");
+    }
+}
+
+void CheckCRCErrors()
+{
+    Simulator_t simulator;
+    VirtualClock_t::Advance(MicroSecs_t(100000));
+    Transfer(simulator, READ_STATUS_SUMMARY);
+
+    auto corrupted = CHANGE_TO_MODE_2;
+    corrupted[3] ^= 0x01;
+
+    Expect(Transfer(simulator, corrupted).m_ReturnStatus == ReturnStatus_t::ERROR, "RS '11' upon a wrong CRC");
+    Expect(simulator.GetCRCErrors() == 1, "The wrong CRC is counted");
+    Expect(simulator.GetMode() == OperationMode_t::MODE_1, "The corrupted write is discarded");
+
+    Expect(Transfer(simulator, READ_WHO_AM_I).m_ReturnStatus == ReturnStatus_t::NORMAL_OPERATION_NO_FLAGS,
+           "STATUS is not changed by a wrong CRC");
+}
+
+int main()
+{
+    CheckStartup();
+    CheckInterFrameGap();
+    CheckMemoryBanks();
+    CheckStatusClearOnRead();
+    CheckModeSensitivities();
+    CheckCRCErrors();
+
+    if (g_Failures != 0)
+    {
+        printf("FAILED [%lu] checks\n", static_cast<unsigned long>(g_Failures));
+        return EXIT_FAILURE;
+    }
+
+    printf("PASSED\n");
+    return EXIT_SUCCESS;
+}
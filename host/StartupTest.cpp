@@ -0,0 +1,90 @@
+/***********************************************************************
+* @file      StartupTest.cpp
+*
+*    Host check of the start-up policies against the simulator, whose
+*    Mode 4 signal path settles in 40 ms; well within the 100 ms that the
+*    datasheet allows for.
+*
+*    - DATASHEET_SETTLING must wait out the tabulated 100 ms regardless.
+*    - READINESS_POLLING must end start-up once the RS bits read '01';
+*      i.e. no earlier than the 40 ms, and well before the 100 ms.
+*    - READINESS_POLLING must fall back to the tabulated wait should the
+*      simulated path take longer (150 ms) than the datasheet allows.
+*
+* @brief   Exits non-zero should any of the above not hold, or should the
+*          first sweep after start-up fail.
+*
+* @note    The device waits out real time; latencies are hence bounded
+*          generously rather than exactly.
+*
+* @author  Nuertey Odzeyem
+*
+* @date    October 17, 2026
+*
+* @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
+***********************************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+
+#include "NuerteySCL3300Device.h"
+#include "SCL3300Simulator.h"
+
+using namespace Simulation;
+
+using HostDevice_t = FixedModeSCL3300Device<OperationMode_t::MODE_4, InMemorySPITransport<SCL3300Simulator<>>>;
+
+constexpr MicroSecs_t DATASHEET_SETTLING_TIME{100000};
+
+StartupStatistics_t LaunchStartup(const StartupPolicy_t& policy,
+                                  const MicroSecs_t& settlingTime,
+                                  std::error_code& firstSweepResult)
+{
+    SimulatorTimings_t timings;
+    timings.m_Mode3And4SettlingTime = settlingTime;
+
+    HostDevice_t device(std::in_place, 0, 0, 8, 4'000'000,
+                        SCL3300Simulator<>(Waveforms::Tilt(30.0, -10.0), timings));
+
+    device.SetStartupPolicy(policy);
+    device.LaunchStartupSequence();
+
+    firstSweepResult = device.ReadAllSensorDataPipelined();
+
+    return device.GetStartupStatistics();
+}
+
+int main()
+{
+    std::error_code settledResult{};
+    std::error_code polledResult{};
+    std::error_code fallbackResult{};
+
+    const auto settled  = LaunchStartup(StartupPolicy_t::DATASHEET_SETTLING, MicroSecs_t(40000), settledResult);
+    const auto polled   = LaunchStartup(StartupPolicy_t::READINESS_POLLING,  MicroSecs_t(40000), polledResult);
+    const auto fallback = LaunchStartup(StartupPolicy_t::READINESS_POLLING,  MicroSecs_t(150000), fallbackResult);
+
+    printf("\nReady after: settled [%lld us], polled [%lld us] in [%lu] polls, fell back [%lld us].\n",
+        static_cast<long long>(settled.m_ReadyLatency.count()),
+        static_cast<long long>(polled.m_ReadyLatency.count()),
+        static_cast<unsigned long>(polled.m_ReadinessPolls),
+        static_cast<long long>(fallback.m_ReadyLatency.count()));
+
+    const bool isSettledCorrect  = !settledResult && (settled.m_ReadyLatency >= DATASHEET_SETTLING_TIME);
+
+    const bool isPolledCorrect   = !polledResult && !polled.m_PollingTimedOut
+                                && (polled.m_ReadyLatency >= MicroSecs_t(40000))
+                                && (polled.m_ReadyLatency < MicroSecs_t(75000));
+
+    const bool isFallbackCorrect = !fallbackResult && fallback.m_PollingTimedOut
+                                && (fallback.m_ReadyLatency >= DATASHEET_SETTLING_TIME);
+
+    if (!isSettledCorrect || !isPolledCorrect || !isFallbackCorrect)
+    {
+        printf("FAILED\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("PASSED\n");
+    return EXIT_SUCCESS;
+}
@@ -39,6 +39,9 @@
 * @copyright Copyright (c) 2025 Nuertey Odzeyem. All Rights Reserved.
 ***********************************************************************/
 #include "NuerteySCL3300Device.h"
+#include "SamplingEngine.h"
+#include "SensorStateMachine.h"
+#include "AllocationGuard.h"
 
 #define LED_ON  1
 #define LED_OFF 0
@@ -73,13 +76,120 @@
 //        PinName miso
 //        PinName sclk
 //        PinName ssel
-NuerteySCL3300Device g_SCL3300Device(D11, D12, D13, D10); 
+// Deployed units are only ever operated in Mode 4 (inclination, low 
+// noise); fix it at compile time so as to fold the mode constants.
+FixedModeSCL3300Device<OperationMode_t::MODE_4> g_SCL3300Device(D11, D12, D13, D10); 
+
+// Structural monitoring requires a regular time series; sweep the angles,
+// accelerations and STATUS at a fixed rate.
+Acquisition::SamplingEngine g_SamplingEngine(g_SCL3300Device);
+
+constexpr auto SAMPLING_PERIOD = 10ms; // 100 Hz
+
+constexpr ChannelSet_t SAMPLED_CHANNELS = MakeChannelSet(
+                                              Channel_t::ACCELERATION_X_AXIS,
+                                              Channel_t::ACCELERATION_Y_AXIS,
+                                              Channel_t::ACCELERATION_Z_AXIS,
+                                              Channel_t::ANGLE_X_AXIS,
+                                              Channel_t::ANGLE_Y_AXIS,
+                                              Channel_t::ANGLE_Z_AXIS,
+                                              Channel_t::STATUS_SUMMARY);
         
 // As per my ARM NUCLEO-F767ZI specs:        
 DigitalOut        g_LEDGreen(LED1);
 DigitalOut        g_LEDBlue(LED2);
 DigitalOut        g_LEDRed(LED3);
 
+// Timeouts and transfer completions of the sensor's state machine are
+// dispatched here; i.e. neither start-up nor recovery ever holds up the
+// application thread, nor any other sensor sharing this queue.
+EventQueue        g_EventQueue(16 * EVENTS_EVENT_SIZE);
+Thread            g_EventThread(osPriorityAboveNormal, 2048, nullptr, "SCL3300Events");
+
+// Sequences start-up, self-test and power down. Sampling proper is left
+// to the sampling engine; hence no monitoring period is configured.
+Supervision::SensorStateMachine g_SensorStateMachine(g_SCL3300Device, g_EventQueue);
+
+// In between runs, keep watch at a fraction of the power: every 5 s, wake
+// the sensor up for a burst of 8 sweeps, averaged into a single sample.
+constexpr Supervision::DutyCycle_t STATION_DUTY_CYCLE{5s, 8, 8, 10ms};
+
+static_assert(Supervision::IsValidDutyCycle(STATION_DUTY_CYCLE));
+
+// One flag per Supervision::SensorState_t, set upon entering it. The one
+// beyond them is set once the event queue has caught up.
+EventFlags        g_SensorStateFlags;
+
+constexpr uint32_t EVENT_QUEUE_CAUGHT_UP_FLAG = 1UL << ToUnderlyingType(Supervision::SensorState_t::NUMBER_OF_STATES);
+
+// The driver defers its diagnostics; format them here, well out of the
+// way of the sampling thread.
+Thread            g_LoggingThread(osPriorityLow, 2048, nullptr, "SCL3300Log");
+
+void LogEvents()
+{
+    while (true)
+    {
+        g_SCL3300Device.PrintEventLog();
+        ThisThread::sleep_for(250ms);
+    }
+}
+
+void OnSensorStateChange(Supervision::SensorState_t state)
+{
+    g_SensorStateFlags.set(1UL << ToUnderlyingType(state));
+}
+
+// Only this thread waits; the sensor itself is driven by the event thread.
+bool AwaitSensorState(const Supervision::SensorState_t& state)
+{
+    const uint32_t flag  = 1UL << ToUnderlyingType(state);
+    const uint32_t flags = g_SensorStateFlags.wait_any(flag, 2s);
+
+    if ((flags & osFlagsError) || !(flags & flag))
+    {
+        printf("Error! Sensor did not reach the %s state; it is in %s.\n",
+               Supervision::ToString(state).data(),
+               Supervision::ToString(g_SensorStateMachine.GetState()).data());
+        return false;
+    }
+
+    return true;
+}
+
+// Powers the sensor down, duty-cycled or not, and returns once the state
+// machine has come to rest there; i.e. with nothing left scheduled.
+bool StopSensor()
+{
+    g_SensorStateFlags.clear();
+    g_SensorStateMachine.RequestPowerDown();
+
+    // Whilst sleeping in between bursts, the sensor is PowerDown already
+    // and no transition is signalled; hence wait out the request itself.
+    g_EventQueue.call([] { g_SensorStateFlags.set(EVENT_QUEUE_CAUGHT_UP_FLAG); });
+    g_SensorStateFlags.wait_any(EVENT_QUEUE_CAUGHT_UP_FLAG, 2s);
+
+    return (g_SensorStateMachine.GetState() == Supervision::SensorState_t::POWER_DOWN)
+        || AwaitSensorState(Supervision::SensorState_t::POWER_DOWN);
+}
+
+// Invoked from the event thread with each averaged, duty-cycled sample.
+void OnAveragedSample([[maybe_unused]] const SCL3300Sample_t& sample)
+{
+    g_LEDGreen = !g_LEDGreen;
+}
+
+// Invoked from the sampling thread with each timestamped sample.
+void OnSample(const SCL3300Sample_t& sample)
+{
+    // Blink at ~1 Hz as evidence of life; anything heavier belongs
+    // in a consumer thread.
+    if ((sample.m_SequenceNumber % 100) == 0)
+    {
+        g_LEDGreen = !g_LEDGreen;
+    }
+}
+
 int main()
 {
     printf("\r\n\r\nmbed-ce-Nuertey-SCL3300 - Beginning... \r\n\r\n");
@@ -88,7 +198,31 @@ int main()
     g_LEDBlue = LED_ON;
     g_LEDGreen = LED_ON;
     
-    g_SCL3300Device.LaunchStartupSequence();
+    g_LoggingThread.start(mbed::callback(LogEvents));
+    g_EventThread.start(mbed::callback(&g_EventQueue, &EventQueue::dispatch_forever));
+
+    g_SensorStateMachine.Configure(0ms, mbed::callback(OnSensorStateChange),
+                                   mbed::callback(OnAveragedSample));
+
+    // The sensor is powered down between runs; have each wake-up proceed
+    // as soon as the sensor is ready rather than after the worst case.
+    g_SCL3300Device.SetStartupPolicy(StartupPolicy_t::READINESS_POLLING);
+
+    // Reject (and report) a channel set or rate which the sensor cannot
+    // sustain. That is a build-time mistake which no retry would mend;
+    // hence halt, signalling so with the red LED.
+    auto status = g_SamplingEngine.Configure(SAMPLED_CHANNELS, SAMPLING_PERIOD);
+    if (status)
+    {
+        printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
+                  status.value(), GetErrorMessage(status));
+
+        g_LEDRed = LED_ON;
+        while (true)
+        {
+            ThisThread::sleep_for(1s);
+        }
+    }
 
     // Do not return from main() as in Embedded Systems, there is nothing
     // (conceptually) to return to. Otherwise the processor would halt and 
@@ -98,19 +232,96 @@ int main()
         // Indicate with LEDs that we are commencing.
         g_LEDBlue = LED_ON;
         g_LEDGreen = LED_ON;
+
+        // Starts up afresh, or wakes up from the previous power down.
+        g_SensorStateFlags.clear();
+        g_SensorStateMachine.Start();
+
+        if (!AwaitSensorState(Supervision::SensorState_t::NORMAL))
+        {
+            g_LEDRed = LED_ON;
+            ThisThread::sleep_for(1s);
+            continue;
+        }
         
         g_SCL3300Device.LaunchNormalOperationSequence();
 
-        // Allow the user the chance to view the results:
-        ThisThread::sleep_for(60s);
+        // Acquire a regular time series for a while. 
+        g_SamplingEngine.ResetStatistics();
+        status = g_SamplingEngine.Start(mbed::callback(OnSample));
+        if (status)
+        {
+            printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
+                      status.value(), GetErrorMessage(status));
+
+            // Power down, so that the next attempt starts up afresh.
+            StopSensor();
+
+            g_LEDRed = LED_ON;
+            ThisThread::sleep_for(1s);
+            continue;
+        }
+
+        // Once started, acquisition must never touch the heap.
+        Diagnostics::AllocationGuard allocationGuard;
+
+        for (auto elapsed = 0s; elapsed < 60s; elapsed += 1s)
+        {
+            ThisThread::sleep_for(1s);
+
+            // Drain the second's worth of samples in bulk. The sampler is
+            // never held up by this; at worst it counts ring overruns.
+            double sumAngleX = 0.0;
+            const auto count = g_SamplingEngine.GetSampleRing().Drain(
+                [&sumAngleX](std::span<const SCL3300Sample_t> samples)
+                {
+                    for (const auto& sample : samples)
+                    {
+                        sumAngleX += sample.Get(Channel_t::ANGLE_X_AXIS);
+                    }
+                });
+
+            if (count > 0)
+            {
+                Formatting::TextBuffer_t<> buffer;
+                printf("Drained %u samples; mean ANG_X := [%s] raw LSB\n", 
+                       static_cast<unsigned>(count), 
+                       Formatting::FormatFixed(buffer, sumAngleX / count).data());
+            }
+        }
+
+        if (!allocationGuard.IsClean())
+        {
+            printf("Warning! %lu bytes were allocated on the heap during acquisition.\n",
+                   static_cast<unsigned long>(allocationGuard.GetAllocatedBytes()));
+        }
+
+        g_SamplingEngine.Stop();
+        g_SamplingEngine.PrintStatistics();
+        g_SCL3300Device.PrintStartupStatistics();
                 
-        g_SCL3300Device.LaunchSelfTestMonitoring();
+        g_SensorStateFlags.clear();
+        g_SensorStateMachine.RequestSelfTest();
+
+        if (AwaitSensorState(Supervision::SensorState_t::NORMAL)
+            && g_SensorStateMachine.GetLastError())
+        {
+            const auto result = g_SensorStateMachine.GetLastError();
+            printf("Error! %s: \n\t[%d] -> %s\n", __PRETTY_FUNCTION__,
+                      result.value(), GetErrorMessage(result));
+        }
 
         g_LEDGreen = LED_OFF;
         g_LEDBlue = LED_OFF;
+
+        // No need to keep the sensor powered meanwhile, bar its bursts.
+        g_SensorStateMachine.StartDutyCycle(STATION_DUTY_CYCLE);
         
         // Allow the user the chance to view the results:
         ThisThread::sleep_for(180s);
+
+        StopSensor();
+        g_SensorStateMachine.PrintDutyCycleStatistics();
     }
 
     printf("\r\n\r\nmbed-ce-Nuertey-SCL3300 Application - Exiting.\r\n\r\n");